@@ -0,0 +1,260 @@
+#pragma once
+// Letters the game can be played with. Words and guesses are UTF-8; every
+// code point is case-folded to one canonical (upper-case) letter, and each
+// alphabet maps its letters to dense indices 0..size-1 (at most 64, so a
+// round's tried letters fit one uint64_t). The index is a 128-entry table for
+// ASCII plus a binary search over the sorted alphabet for everything else:
+// no allocation and a handful of compares per lookup.
+//
+// Kept free of raylib (like hangman_rules.h) for the headless tools.
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+enum class AlphabetId : uint8_t {
+    ENGLISH,   // A-Z
+    LATIN,     // A-Z plus the accented letters of the main western European languages
+    GREEK,     // Α-Ω (accents fold to the plain letter)
+    CYRILLIC,  // А-Я plus Ё
+    COUNT
+};
+
+static const char* const ALPHABET_NAMES[(int)AlphabetId::COUNT] = {
+    "ENGLISH", "LATIN", "GREEK", "CYRILLIC"
+};
+
+// ---------------- UTF-8 ----------------
+
+// Decodes one code point at s[i]; advances i. Malformed bytes come back as
+// U+FFFD one byte at a time, so a bad string can't stall a loop.
+inline uint32_t Utf8Next(std::string_view s, size_t& i) {
+    unsigned char c = (unsigned char)s[i];
+    int extra = c < 0x80 ? 0 : (c >> 5) == 0x6 ? 1 : (c >> 4) == 0xE ? 2 : (c >> 3) == 0x1E ? 3 : -1;
+    if (extra < 0 || i + (size_t)extra >= s.size()) {
+        i++;
+        return 0xFFFD;
+    }
+    uint32_t cp = extra == 0 ? c : (c & (0x3F >> extra));
+    for (int k = 1; k <= extra; ++k) {
+        unsigned char cc = (unsigned char)s[i + k];
+        if ((cc & 0xC0) != 0x80) {
+            i++;
+            return 0xFFFD;
+        }
+        cp = (cp << 6) | (cc & 0x3F);
+    }
+    i += 1 + extra;
+    return cp;
+}
+
+// Out: std::string or FixedString (anything with push_back(char))
+template <class Out>
+inline void Utf8Append(Out& out, uint32_t cp) {
+    if (cp < 0x80) {
+        out.push_back((char)cp);
+    } else if (cp < 0x800) {
+        out.push_back((char)(0xC0 | (cp >> 6)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else if (cp < 0x10000) {
+        out.push_back((char)(0xE0 | (cp >> 12)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    } else {
+        out.push_back((char)(0xF0 | (cp >> 18)));
+        out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+        out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+        out.push_back((char)(0x80 | (cp & 0x3F)));
+    }
+}
+
+inline int Utf8Length(std::string_view s) {
+    int n = 0;
+    for (size_t i = 0; i < s.size();) {
+        Utf8Next(s, i);
+        n++;
+    }
+    return n;
+}
+
+// Removes the last code point (for backspace in text fields)
+template <class Str>
+inline void Utf8PopBack(Str& s) {
+    while (!s.empty()) {
+        unsigned char c = (unsigned char)s.back();
+        s.pop_back();
+        if ((c & 0xC0) != 0x80) break;
+    }
+}
+
+// ---------------- Case folding ----------------
+
+// Canonical letter for a code point: upper case, and for Greek without the
+// tonos/dialytika (a guess of Α also reveals ά). Other code points unchanged.
+inline uint32_t FoldCase(uint32_t cp) {
+    if (cp < 0x80) return (cp >= 'a' && cp <= 'z') ? cp - 0x20 : cp;
+
+    // Latin-1 Supplement
+    if (cp >= 0xE0 && cp <= 0xFE && cp != 0xF7) return cp - 0x20;
+    if (cp == 0xFF) return 0x178;
+    if (cp == 0x1E9E) return 0xDF; // capital sharp s
+
+    // Latin Extended-A: upper/lower pairs, upper on the even code point except
+    // in two runs where it is odd; a few letters have no pair
+    if (cp >= 0x100 && cp <= 0x17F) {
+        if (cp == 0x131 || cp == 0x138 || cp == 0x149 || cp == 0x17F) return cp;
+        bool oddUpper = (cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E);
+        if (oddUpper) return (cp & 1u) ? cp : cp - 1;
+        return cp & ~1u;
+    }
+
+    // Greek
+    if (cp >= 0x386 && cp <= 0x3CE) {
+        switch (cp) {
+            case 0x386: case 0x3AC:             return 0x391; // Α
+            case 0x388: case 0x3AD:             return 0x395; // Ε
+            case 0x389: case 0x3AE:             return 0x397; // Η
+            case 0x38A: case 0x3AF: case 0x3AA:
+            case 0x3CA: case 0x390:             return 0x399; // Ι
+            case 0x38C: case 0x3CC:             return 0x39F; // Ο
+            case 0x38E: case 0x3CD: case 0x3AB:
+            case 0x3CB: case 0x3B0:             return 0x3A5; // Υ
+            case 0x38F: case 0x3CE:             return 0x3A9; // Ω
+            case 0x3C2:                         return 0x3A3; // final sigma
+        }
+        if (cp >= 0x3B1 && cp <= 0x3C9) return cp - 0x20;
+        return cp;
+    }
+
+    // Cyrillic
+    if (cp >= 0x430 && cp <= 0x44F) return cp - 0x20;
+    if (cp >= 0x450 && cp <= 0x45F) return cp - 0x50;
+    return cp;
+}
+
+// ---------------- Alphabets ----------------
+
+class Alphabet {
+public:
+    static const int MAX_LETTERS = 64;
+
+    static const Alphabet& Get(AlphabetId id) {
+        static const Alphabet table[(int)AlphabetId::COUNT] = {
+            Alphabet(AlphabetId::ENGLISH), Alphabet(AlphabetId::LATIN),
+            Alphabet(AlphabetId::GREEK), Alphabet(AlphabetId::CYRILLIC)
+        };
+        int i = (int)id < (int)AlphabetId::COUNT ? (int)id : 0;
+        return table[i];
+    }
+
+    AlphabetId Id() const { return id; }
+    const char* Name() const { return ALPHABET_NAMES[(int)id]; }
+    int Size() const { return size; }
+
+    // i-th letter (upper case) in keyboard order
+    uint32_t Letter(int i) const { return letters[i]; }
+
+    // Index of an already folded letter, or -1
+    int IndexOfFolded(uint32_t folded) const {
+        if (folded < 128) return ascii[folded];
+        int lo = asciiCount, hi = size - 1;  // non-ASCII part of sorted[]
+        while (lo <= hi) {
+            int mid = (lo + hi) >> 1;
+            uint32_t v = sorted[mid];
+            if (v == folded) return sortedIndex[mid];
+            if (v < folded) lo = mid + 1;
+            else hi = mid - 1;
+        }
+        return -1;
+    }
+
+    // Index of any code point (either case), or -1
+    int IndexOf(uint32_t cp) const { return IndexOfFolded(FoldCase(cp)); }
+
+    // Every code point the UI font needs for this alphabet, both cases
+    // (walks the ranges FoldCase maps, so accented variants on either side of
+    // their letter, like Ά below Α, come along)
+    void AppendGlyphs(std::vector<int>& out) const {
+        static const uint32_t ranges[][2] = { { 0xC0, 0x17F }, { 0x386, 0x3CE }, { 0x400, 0x45F }, { 0x1E9E, 0x1E9E } };
+        for (const auto& r : ranges) {
+            for (uint32_t cp = r[0]; cp <= r[1]; ++cp) {
+                if (IndexOfFolded(FoldCase(cp)) >= 0) out.push_back((int)cp);
+            }
+        }
+    }
+
+private:
+    AlphabetId id = AlphabetId::ENGLISH;
+    uint32_t letters[MAX_LETTERS] = {};
+    uint32_t sorted[MAX_LETTERS] = {};
+    uint8_t sortedIndex[MAX_LETTERS] = {};
+    int8_t ascii[128];
+    int size = 0;
+    int asciiCount = 0;
+
+    explicit Alphabet(AlphabetId alphabet) : id(alphabet) {
+        for (int c = 'A'; c <= 'Z' && alphabet != AlphabetId::GREEK && alphabet != AlphabetId::CYRILLIC; ++c) Add((uint32_t)c);
+        if (alphabet == AlphabetId::LATIN) {
+            // ß has no everyday capital, so it is its own letter (ẞ folds to it)
+            static const uint16_t extra[] = {
+                0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC,
+                0xCD, 0xCE, 0xCF, 0xD1, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD8, 0xD9, 0xDA, 0xDB,
+                0xDC, 0xDD, 0xDF, 0x152, 0x178
+            };
+            for (uint16_t cp : extra) Add(cp);
+        } else if (alphabet == AlphabetId::GREEK) {
+            for (uint32_t cp = 0x391; cp <= 0x3A9; ++cp) {
+                if (cp != 0x3A2) Add(cp); // U+03A2 is unassigned
+            }
+        } else if (alphabet == AlphabetId::CYRILLIC) {
+            for (uint32_t cp = 0x410; cp <= 0x42F; ++cp) {
+                Add(cp);
+                if (cp == 0x415) Add(0x401); // Ё after Е
+            }
+        }
+
+        // Lookup tables: ASCII direct, the rest sorted
+        for (int c = 0; c < 128; ++c) ascii[c] = -1;
+        for (int i = 0; i < size; ++i) {
+            sorted[i] = letters[i];
+            sortedIndex[i] = (uint8_t)i;
+            if (letters[i] < 128) {
+                ascii[letters[i]] = (int8_t)i;
+                asciiCount++;
+            }
+        }
+        for (int i = 1; i < size; ++i) { // insertion sort, done once
+            uint32_t v = sorted[i];
+            uint8_t x = sortedIndex[i];
+            int j = i - 1;
+            while (j >= 0 && sorted[j] > v) {
+                sorted[j + 1] = sorted[j];
+                sortedIndex[j + 1] = sortedIndex[j];
+                j--;
+            }
+            sorted[j + 1] = v;
+            sortedIndex[j + 1] = x;
+        }
+    }
+
+    void Add(uint32_t cp) {
+        if (size < MAX_LETTERS) letters[size++] = cp;
+    }
+};
+
+// True for a letter of any supported alphabet (decides LETTER vs TEXT input)
+inline bool IsAlphabetLetter(uint32_t cp) {
+    uint32_t f = FoldCase(cp);
+    for (int a = 0; a < (int)AlphabetId::COUNT; ++a) {
+        if (Alphabet::Get((AlphabetId)a).IndexOfFolded(f) >= 0) return true;
+    }
+    return false;
+}
+
+// Upper-cased (folded) copy of a UTF-8 string
+inline std::string Upper(std::string_view s) {
+    std::string r;
+    r.reserve(s.size());
+    for (size_t i = 0; i < s.size();) Utf8Append(r, FoldCase(Utf8Next(s, i)));
+    return r;
+}
@@ -0,0 +1,176 @@
+#pragma once
+// Background asset loading. A worker thread reads and decodes files (image
+// decode, WAV parse, raw OGG bytes, the UI font's SDF bake); the main thread polls for finished items
+// and does the GPU/audio-device uploads, which must stay on that thread.
+//
+// If assets.pack (see asset_packer.cpp) is present, everything comes from
+// that one mapping instead: pixels are uploaded straight from it and the
+// OGG stream decodes from it, so no loose files are opened or decoded.
+#include "raylib.h"
+#include "asset_pack.h"
+#include "font_manager.h"
+#include <cstring>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+enum class AssetId {
+    START_BG,     // start_bg.jpg   -> Texture2D
+    WINDOW_ICON,  // hangman_img.png -> Image (SetWindowIcon)
+    CLICK_SOUND,  // click.wav      -> Sound
+    MUSIC,        // music.ogg      -> Music (streamed from memory)
+    UI_FONT       // ui_font.ttf    -> SDF Font (atlas in image, uploaded by FontManager)
+};
+
+static const char* const ASSET_NAMES[] = { "start_bg", "window_icon", "click_sound", "music", "ui_font" };
+
+// Decoded on the worker, handed to the main thread for upload
+struct LoadedAsset {
+    AssetId id;
+    Image image{};                 // START_BG, WINDOW_ICON, UI_FONT atlas
+    Font font{};                   // UI_FONT: glyphs + recs, no texture yet
+    Wave wave{};                   // CLICK_SOUND
+    unsigned char* data = nullptr; // MUSIC: encoded file bytes (LoadFileData)
+    int dataSize = 0;
+    double loadMs = 0.0;           // read + decode time on the worker
+    bool borrowed = false;         // image.data / data point into the asset pack
+};
+
+class AssetManager {
+public:
+    ~AssetManager() {
+        if (worker.joinable()) worker.join();
+        for (LoadedAsset& a : ready) Release(a);
+    }
+
+    void Start() {
+        pending = 5;
+        worker = std::thread([this]() { Run(); });
+    }
+
+    // Moves finished assets into out (main thread); returns how many
+    int Poll(std::vector<LoadedAsset>& out) {
+        out.clear();
+        std::lock_guard<std::mutex> lock(mutex);
+        out.swap(ready);
+        pending -= (int)out.size();
+        return (int)out.size();
+    }
+
+    bool Busy() const { return pending > 0; }
+
+    // Frees whatever a LoadedAsset still owns
+    static void Release(LoadedAsset& a) {
+        if (!a.borrowed) {
+            if (a.image.data != nullptr) UnloadImage(a.image);
+            if (a.data != nullptr) UnloadFileData(a.data);
+        }
+        if (a.wave.data != nullptr) UnloadWave(a.wave);
+        if (a.font.glyphs != nullptr) {
+            UnloadFontData(a.font.glyphs, a.font.glyphCount);
+            MemFree(a.font.recs);
+        }
+        a.image = Image{};
+        a.wave = Wave{};
+        a.font = Font{};
+        a.data = nullptr;
+    }
+
+private:
+    AssetPack pack; // stays mapped for the manager's lifetime (music streams from it)
+    std::thread worker;
+    std::mutex mutex;
+    std::vector<LoadedAsset> ready;
+    int pending = 0; // main thread only
+
+    void Publish(LoadedAsset a, std::chrono::steady_clock::time_point t0) {
+        a.loadMs = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - t0).count();
+        std::lock_guard<std::mutex> lock(mutex);
+        ready.push_back(a);
+    }
+
+    // Pixels straight out of the pack; copy = true for images the caller keeps and frees
+    bool ImageFromPack(const char* name, Image& out, bool copy) {
+        const PackEntry* e = pack.Find(name);
+        if (e == nullptr || e->kind != (uint32_t)PackKind::PIXELS) return false;
+
+        out.width = e->width;
+        out.height = e->height;
+        out.mipmaps = 1;
+        out.format = e->format;
+        if (copy) {
+            out.data = MemAlloc(e->size);
+            std::memcpy(out.data, pack.Payload(*e), e->size);
+        } else {
+            out.data = (void*)pack.Payload(*e);
+        }
+        return true;
+    }
+
+    const PackEntry* FileFromPack(const char* name) {
+        const PackEntry* e = pack.Find(name);
+        return (e != nullptr && e->kind == (uint32_t)PackKind::FILE) ? e : nullptr;
+    }
+
+    // Cheapest visible asset first so the start screen fills in quickly.
+    // Anything missing from the pack falls back to the loose file.
+    void Run() {
+        using clock = std::chrono::steady_clock;
+
+        clock::time_point t0 = clock::now();
+        if (pack.Open("assets.pack")) {
+            TraceLog(LOG_INFO, "ASSETS: using assets.pack");
+        }
+
+        LoadedAsset icon{ AssetId::WINDOW_ICON };
+        if (!ImageFromPack("hangman_img.png", icon.image, true)) {
+            icon.image = LoadImage("hangman_img.png");
+        }
+        Publish(icon, t0);
+
+        t0 = clock::now();
+        LoadedAsset bg{ AssetId::START_BG };
+        if (ImageFromPack("start_bg.jpg", bg.image, false)) {
+            bg.borrowed = true;
+        } else {
+            bg.image = LoadImage("start_bg.jpg");
+        }
+        Publish(bg, t0);
+
+        t0 = clock::now();
+        LoadedAsset click{ AssetId::CLICK_SOUND };
+        if (const PackEntry* e = FileFromPack("click.wav")) {
+            click.wave = LoadWaveFromMemory(".wav", pack.Payload(*e), (int)e->size);
+        } else {
+            click.wave = LoadWave("click.wav");
+        }
+        Publish(click, t0);
+
+        // NOTE: Replace "music.ogg" with your actual music file name.
+        t0 = clock::now();
+        LoadedAsset music{ AssetId::MUSIC };
+        if (const PackEntry* e = FileFromPack("music.ogg")) {
+            music.data = (unsigned char*)pack.Payload(*e);
+            music.dataSize = (int)e->size;
+            music.borrowed = true;
+        } else {
+            music.data = LoadFileData("music.ogg", &music.dataSize);
+        }
+        Publish(music, t0);
+
+        // Optional: without it the game keeps the built-in font
+        t0 = clock::now();
+        LoadedAsset font{ AssetId::UI_FONT };
+        if (const PackEntry* e = FileFromPack(UI_FONT_FILE)) {
+            BakeSdfFont(pack.Payload(*e), (int)e->size, font.font, font.image);
+        } else if (FileExists(UI_FONT_FILE)) {
+            int size = 0;
+            unsigned char* ttf = LoadFileData(UI_FONT_FILE, &size);
+            if (ttf != nullptr) BakeSdfFont(ttf, size, font.font, font.image);
+            UnloadFileData(ttf);
+        }
+        Publish(font, t0);
+    }
+};
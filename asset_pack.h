@@ -0,0 +1,80 @@
+#pragma once
+// assets.pack: every runtime asset in one memory-mapped file, written at
+// build time by asset_packer. Images are stored as decoded pixels ready for
+// texture upload; audio is stored as the original encoded bytes.
+//
+// Layout: PackHeader, PackEntry[count], then 16-byte aligned payloads.
+#include "mapped_file.h"
+#include <cstdint>
+#include <cstring>
+
+static const char     PACK_MAGIC[4] = { 'H', 'G', 'P', 'K' };
+static const uint32_t PACK_VERSION  = 1;
+static const uint32_t PACK_ALIGN    = 16;
+
+enum class PackKind : uint32_t {
+    PIXELS = 1, // raw pixels: width, height, pixel format (raylib PixelFormat)
+    FILE   = 2  // original file bytes (e.g. .wav, .ogg)
+};
+
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t count;
+    uint32_t reserved;
+};
+
+struct PackEntry {
+    char name[48];      // source file name, NUL-terminated
+    uint32_t kind;      // PackKind
+    uint32_t offset;    // from start of the pack
+    uint32_t size;      // payload bytes
+    int32_t width;      // PIXELS only
+    int32_t height;
+    int32_t format;
+};
+
+class AssetPack {
+public:
+    bool Open(const char* path) {
+        if (!file.Open(path)) return false;
+
+        const PackHeader* h = Header();
+        bool ok = file.Size() >= sizeof(PackHeader) &&
+                  std::memcmp(h->magic, PACK_MAGIC, 4) == 0 &&
+                  h->version == PACK_VERSION &&
+                  file.Size() >= sizeof(PackHeader) + h->count * sizeof(PackEntry);
+        if (ok) {
+            for (uint32_t i = 0; i < h->count; ++i) {
+                const PackEntry& e = Entries()[i];
+                if ((size_t)e.offset + e.size > file.Size()) ok = false;
+            }
+        }
+        if (!ok) file.Close();
+        return ok;
+    }
+
+    bool IsOpen() const { return file.IsOpen(); }
+
+    const PackEntry* Find(const char* name) const {
+        if (!file.IsOpen()) return nullptr;
+        for (uint32_t i = 0; i < Header()->count; ++i) {
+            if (std::strncmp(Entries()[i].name, name, sizeof(PackEntry::name)) == 0) {
+                return &Entries()[i];
+            }
+        }
+        return nullptr;
+    }
+
+    const unsigned char* Payload(const PackEntry& e) const {
+        return file.Data() + e.offset;
+    }
+
+private:
+    MappedFile file;
+
+    const PackHeader* Header() const { return (const PackHeader*)file.Data(); }
+    const PackEntry* Entries() const {
+        return (const PackEntry*)(file.Data() + sizeof(PackHeader));
+    }
+};
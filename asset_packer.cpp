@@ -0,0 +1,116 @@
+// Build-time asset packer: bakes the game's images (decoded to raw pixels)
+// and audio (as-is) into one assets.pack that the game memory-maps.
+//
+// Usage: asset_packer <out.pack> <file>...
+//        asset_packer assets.pack start_bg.jpg hangman_img.png click.wav music.ogg
+#include "raylib.h"
+#include "asset_pack.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct PendingEntry {
+    PackEntry entry;
+    std::vector<unsigned char> payload;
+};
+
+static bool IsImageFile(const char* path) {
+    const char* dot = std::strrchr(path, '.');
+    if (dot == nullptr) return false;
+    return std::strcmp(dot, ".png") == 0 || std::strcmp(dot, ".jpg") == 0 ||
+           std::strcmp(dot, ".jpeg") == 0 || std::strcmp(dot, ".bmp") == 0;
+}
+
+static bool AddFile(const char* path, std::vector<PendingEntry>& out) {
+    PendingEntry p{};
+    std::strncpy(p.entry.name, path, sizeof(p.entry.name) - 1);
+
+    if (IsImageFile(path)) {
+        Image img = LoadImage(path);
+        if (img.data == NULL) return false;
+
+        // GPU-ready: uncompressed pixels in the decoder's own format
+        int bytes = GetPixelDataSize(img.width, img.height, img.format);
+        p.entry.kind = (uint32_t)PackKind::PIXELS;
+        p.entry.width = img.width;
+        p.entry.height = img.height;
+        p.entry.format = img.format;
+        p.payload.assign((unsigned char*)img.data, (unsigned char*)img.data + bytes);
+        UnloadImage(img);
+    } else {
+        int size = 0;
+        unsigned char* data = LoadFileData(path, &size);
+        if (data == NULL) return false;
+
+        p.entry.kind = (uint32_t)PackKind::FILE;
+        p.payload.assign(data, data + size);
+        UnloadFileData(data);
+    }
+
+    p.entry.size = (uint32_t)p.payload.size();
+    out.push_back(std::move(p));
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <out.pack> <file>...\n", argv[0]);
+        return 1;
+    }
+    SetTraceLogLevel(LOG_WARNING);
+
+    std::vector<PendingEntry> entries;
+    for (int i = 2; i < argc; ++i) {
+        if (std::strlen(argv[i]) >= sizeof(PackEntry::name)) {
+            std::fprintf(stderr, "name too long: %s\n", argv[i]);
+            return 1;
+        }
+        if (!AddFile(argv[i], entries)) {
+            std::fprintf(stderr, "failed to load %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Assign aligned offsets after the header and entry table
+    uint32_t offset = (uint32_t)(sizeof(PackHeader) + entries.size() * sizeof(PackEntry));
+    for (PendingEntry& p : entries) {
+        offset = (offset + PACK_ALIGN - 1) / PACK_ALIGN * PACK_ALIGN;
+        p.entry.offset = offset;
+        offset += p.entry.size;
+    }
+
+    std::string tmpPath = std::string(argv[1]) + ".tmp";
+    FILE* f = std::fopen(tmpPath.c_str(), "wb");
+    if (f == nullptr) {
+        std::fprintf(stderr, "cannot write %s\n", tmpPath.c_str());
+        return 1;
+    }
+
+    PackHeader header{};
+    std::memcpy(header.magic, PACK_MAGIC, 4);
+    header.version = PACK_VERSION;
+    header.count = (uint32_t)entries.size();
+    std::fwrite(&header, sizeof(header), 1, f);
+    for (const PendingEntry& p : entries) {
+        std::fwrite(&p.entry, sizeof(PackEntry), 1, f);
+    }
+
+    long pos = (long)(sizeof(PackHeader) + entries.size() * sizeof(PackEntry));
+    for (const PendingEntry& p : entries) {
+        static const unsigned char zeros[PACK_ALIGN] = {};
+        std::fwrite(zeros, 1, p.entry.offset - pos, f);
+        std::fwrite(p.payload.data(), 1, p.payload.size(), f);
+        pos = p.entry.offset + p.entry.size;
+        std::printf("%-24s %10u bytes%s\n", p.entry.name, p.entry.size,
+                    p.entry.kind == (uint32_t)PackKind::PIXELS ? " (pixels)" : "");
+    }
+    std::fclose(f);
+
+    std::remove(argv[1]);
+    if (std::rename(tmpPath.c_str(), argv[1]) != 0) {
+        std::fprintf(stderr, "cannot replace %s\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
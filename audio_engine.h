@@ -0,0 +1,337 @@
+#pragma once
+// Game audio off the main thread.
+//
+// Music: a decode thread turns the OGG into PCM ahead of time and fills a
+// lock-free single-producer/single-consumer ring; the audio device pulls
+// from the ring in a stream callback, so neither side ever waits on the
+// other and the main thread does no per-frame audio work. Switching music
+// off pauses the stream and parks the decode thread (nothing is decoded
+// while muted).
+//
+// UI sounds: one Sound plus a few LoadSoundAlias voices sharing its samples,
+// so overlapping clicks play side by side instead of restarting one voice.
+//
+// The OGG decoder is the stb_vorbis that raylib already compiles into
+// raudio (SUPPORT_FILEFORMAT_OGG); only its C entry points are declared here.
+#include "raylib.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+extern "C" {
+typedef struct stb_vorbis stb_vorbis;
+typedef struct stb_vorbis_alloc stb_vorbis_alloc;
+typedef struct {
+    unsigned int sample_rate;
+    int channels;
+    unsigned int setup_memory_required;
+    unsigned int setup_temp_memory_required;
+    unsigned int temp_memory_required;
+    int max_frame_size;
+} stb_vorbis_info;
+
+stb_vorbis* stb_vorbis_open_memory(const unsigned char* data, int len, int* error,
+                                   const stb_vorbis_alloc* alloc);
+stb_vorbis_info stb_vorbis_get_info(stb_vorbis* f);
+int stb_vorbis_get_samples_short_interleaved(stb_vorbis* f, int channels, short* buffer, int num_shorts);
+int stb_vorbis_seek_start(stb_vorbis* f);
+void stb_vorbis_close(stb_vorbis* f);
+}
+
+// Interleaved 16-bit frames; one writer thread, one reader thread
+class PcmRing {
+public:
+    void Init(uint32_t capacityFrames, int channelCount) {
+        capacity = capacityFrames;          // power of two
+        channels = channelCount;
+        samples.assign((size_t)capacity * channels, 0);
+        writePos.store(0);
+        readPos.store(0);
+    }
+
+    uint32_t Writable() const { return capacity - (writePos.load(std::memory_order_relaxed) - readPos.load(std::memory_order_acquire)); }
+
+    // Writer: appends up to frames; returns how many fit
+    uint32_t Write(const short* in, uint32_t frames) {
+        uint32_t w = writePos.load(std::memory_order_relaxed);
+        uint32_t room = capacity - (w - readPos.load(std::memory_order_acquire));
+        if (frames > room) frames = room;
+        uint32_t first = FirstPiece(w, frames);
+        std::memcpy(At(w), in, first * Stride());
+        std::memcpy(At(0), in + first * channels, (frames - first) * Stride());
+        writePos.store(w + frames, std::memory_order_release);
+        return frames;
+    }
+
+    // Reader: takes up to frames; returns how many were there
+    uint32_t Read(short* out, uint32_t frames) {
+        uint32_t r = readPos.load(std::memory_order_relaxed);
+        uint32_t have = writePos.load(std::memory_order_acquire) - r;
+        if (frames > have) frames = have;
+        uint32_t first = FirstPiece(r, frames);
+        std::memcpy(out, At(r), first * Stride());
+        std::memcpy(out + first * channels, At(0), (frames - first) * Stride());
+        readPos.store(r + frames, std::memory_order_release);
+        return frames;
+    }
+
+private:
+    std::vector<short> samples;
+    uint32_t capacity = 0;
+    int channels = 2;
+    std::atomic<uint32_t> writePos{ 0 }; // free-running frame counters
+    std::atomic<uint32_t> readPos{ 0 };
+
+    short* At(uint32_t pos) { return samples.data() + (size_t)(pos & (capacity - 1)) * channels; }
+    size_t Stride() const { return (size_t)channels * sizeof(short); }
+
+    // Frames before the wrap; the rest continue at the start of the ring
+    uint32_t FirstPiece(uint32_t pos, uint32_t frames) const {
+        uint32_t tail = capacity - (pos & (capacity - 1));
+        return frames < tail ? frames : tail;
+    }
+};
+
+struct AudioStats {
+    double decodeMs = 0.0;    // decode thread, busy time
+    double deviceMs = 0.0;    // time inside the stream callback (device thread)
+    uint64_t decodedFrames = 0;
+    uint64_t underruns = 0;   // callbacks that ran out of decoded audio
+};
+
+class AudioEngine {
+public:
+    static const int VOICES = 4;                 // overlapping UI sounds
+    static const uint32_t RING_FRAMES = 16384;   // ~0.37 s at 44.1 kHz
+    static const uint32_t DECODE_FRAMES = 2048;  // per decode step
+
+    ~AudioEngine() { Shutdown(); }
+
+    // ---- UI sounds ----
+
+    void LoadUiSound(Wave wave) {
+        UnloadUiSound();
+        uiSound = LoadSoundFromWave(wave);
+        if (uiSound.frameCount == 0) return;
+        for (int i = 0; i < VOICES; ++i) voices[i] = LoadSoundAlias(uiSound);
+    }
+
+    // A free voice, or the one that started longest ago
+    void PlayUi() {
+        if (uiSound.frameCount == 0) return;
+        int pick = nextVoice;
+        for (int i = 0; i < VOICES; ++i) {
+            int v = (nextVoice + i) % VOICES;
+            if (!IsSoundPlaying(voices[v])) { pick = v; break; }
+        }
+        PlaySound(voices[pick]);
+        nextVoice = (pick + 1) % VOICES;
+    }
+
+    // ---- Music ----
+
+    // Encoded OGG in memory; owned = free it with UnloadFileData when done
+    bool OpenMusic(unsigned char* data, int size, bool owned) {
+        CloseMusic();
+        musicData = data;
+        musicOwned = owned;
+
+        int error = 0;
+        vorbis = stb_vorbis_open_memory(data, size, &error, nullptr);
+        if (vorbis == nullptr) {
+            TraceLog(LOG_WARNING, "AUDIO: cannot decode music (stb_vorbis error %d)", error);
+            return false;
+        }
+        stb_vorbis_info info = stb_vorbis_get_info(vorbis);
+        channels = info.channels >= 2 ? 2 : 1;
+        ring.Init(RING_FRAMES, channels);
+        pcm.assign((size_t)DECODE_FRAMES * channels, 0);
+
+        stream = LoadAudioStream(info.sample_rate, 16, (unsigned int)channels);
+        SetAudioStreamVolume(stream, 0.5f);
+        Active().store(this);
+        SetAudioStreamCallback(stream, DeviceCallback);
+
+        // Prime the ring so the first device callback already has audio
+        framesSinceSeek = 0;
+        uint64_t before = decodedFrames;
+        while (ring.Writable() >= DECODE_FRAMES && DecodeStep()) {}
+        if (decodedFrames == before) {
+            TraceLog(LOG_WARNING, "AUDIO: music decodes to no samples");
+            CloseMusic();
+            return false;
+        }
+
+        quit = false;
+        decoder = std::thread([this]() { DecodeLoop(); });
+        return true;
+    }
+
+    // Music on/off: off pauses the device stream and parks the decoder
+    void SetMusicPlaying(bool on) {
+        if (vorbis == nullptr || on == musicOn) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            musicOn = on;
+        }
+        wake.notify_one();
+
+        if (on) {
+            if (!started) {
+                PlayAudioStream(stream);
+                started = true;
+            } else {
+                ResumeAudioStream(stream);
+            }
+        } else {
+            PauseAudioStream(stream);
+        }
+    }
+
+    bool MusicPlaying() const { return musicOn; }
+
+    AudioStats Stats() const {
+        AudioStats s;
+        s.decodeMs = decodeNs.load() * 1e-6;
+        s.deviceMs = deviceNs.load() * 1e-6;
+        s.decodedFrames = decodedFrames.load();
+        s.underruns = underruns.load();
+        return s;
+    }
+
+    void Shutdown() {
+        CloseMusic();
+        UnloadUiSound();
+    }
+
+private:
+    // UI
+    Sound uiSound{};
+    Sound voices[VOICES] = {};
+    int nextVoice = 0;
+
+    // Music
+    unsigned char* musicData = nullptr;
+    bool musicOwned = false;
+    stb_vorbis* vorbis = nullptr;
+    int channels = 2;
+    AudioStream stream{};
+    bool started = false;
+    PcmRing ring;
+    std::vector<short> pcm;  // decode scratch; main thread while priming, then the decoder
+    uint64_t framesSinceSeek = 0; // same owner as pcm
+
+    std::thread decoder;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool musicOn = false; // guarded by mutex for the decoder's wait
+    bool quit = false;
+
+    std::atomic<uint64_t> decodeNs{ 0 };
+    std::atomic<uint64_t> deviceNs{ 0 };
+    std::atomic<uint64_t> decodedFrames{ 0 };
+    std::atomic<uint64_t> underruns{ 0 };
+
+    // The stream callback has no user pointer; one engine owns the music stream
+    static std::atomic<AudioEngine*>& Active() {
+        static std::atomic<AudioEngine*> engine{ nullptr };
+        return engine;
+    }
+
+    void UnloadUiSound() {
+        if (uiSound.frameCount == 0) return;
+        for (int i = 0; i < VOICES; ++i) UnloadSoundAlias(voices[i]);
+        UnloadSound(uiSound);
+        uiSound = Sound{};
+    }
+
+    void CloseMusic() {
+        if (decoder.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                quit = true;
+            }
+            wake.notify_one();
+            decoder.join();
+        }
+        if (stream.buffer != nullptr) {
+            StopAudioStream(stream);
+            UnloadAudioStream(stream);
+            stream = AudioStream{};
+        }
+        AudioEngine* self = this;
+        Active().compare_exchange_strong(self, nullptr);
+        if (vorbis != nullptr) stb_vorbis_close(vorbis);
+        vorbis = nullptr;
+        if (musicOwned && musicData != nullptr) UnloadFileData(musicData);
+        musicData = nullptr;
+        musicOn = false;
+        started = false;
+    }
+
+    // Keeps the ring topped up while music is on; sleeps otherwise
+    void DecodeLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            if (quit) return;
+            if (!musicOn) {
+                wake.wait(lock);  // muted: no decoding at all
+                continue;
+            }
+            if (ring.Writable() < DECODE_FRAMES) {
+                // The device drains ~2048 frames in 46 ms; check back sooner
+                wake.wait_for(lock, std::chrono::milliseconds(10));
+                continue;
+            }
+
+            lock.unlock();
+            bool readable = DecodeStep();
+            lock.lock();
+            if (!readable) {
+                wake.wait(lock, [this] { return quit; }); // nothing left to play
+                return;
+            }
+        }
+    }
+
+    // Decodes one chunk into the ring; false if the track could not be read
+    // or a whole pass from the start yielded nothing (looping would spin)
+    bool DecodeStep() {
+        auto t0 = std::chrono::steady_clock::now();
+        int frames = stb_vorbis_get_samples_short_interleaved(
+            vorbis, channels, pcm.data(), (int)pcm.size());
+        bool ok = true;
+        if (frames == 0) {
+            // End of track: loop, unless the pass since the last seek was empty
+            ok = framesSinceSeek > 0 && stb_vorbis_seek_start(vorbis) != 0;
+            framesSinceSeek = 0;
+        } else {
+            ring.Write(pcm.data(), (uint32_t)frames);
+            decodedFrames += (uint64_t)frames;
+            framesSinceSeek += (uint64_t)frames;
+        }
+        decodeNs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count();
+        return ok;
+    }
+
+    // Device thread: copy from the ring, silence on underrun; never blocks
+    static void DeviceCallback(void* buffer, unsigned int frames) {
+        AudioEngine* self = Active().load(std::memory_order_acquire);
+        if (self == nullptr) return;
+        auto t0 = std::chrono::steady_clock::now();
+        short* out = (short*)buffer;
+        uint32_t got = self->ring.Read(out, frames);
+        if (got < frames) {
+            std::memset(out + got * self->channels, 0, (size_t)(frames - got) * self->channels * sizeof(short));
+            self->underruns++;
+        }
+        self->deviceNs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - t0).count();
+    }
+};
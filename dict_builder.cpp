@@ -0,0 +1,149 @@
+// Build-time dictionary indexer: turns plain word lists (one word per line)
+// into the words.dict file the game memory-maps for computer-set rounds.
+//
+// Usage: dict_builder <out.dict> <wordlist.txt>...
+//        dict_builder words.dict words.txt
+//
+// Words are upper-cased; anything that is not 2..DICT_MAX_LEN letters A-Z
+// is skipped. Duplicates are removed within each bucket, and each bucket is
+// sorted by letter-set group (see word_dict.h).
+#include "word_dict.h"
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+static const int MIN_WORD_LEN = 2;
+
+static int DistinctLetters(uint32_t mask) {
+    int n = 0;
+    for (; mask != 0; mask &= mask - 1) n++;
+    return n;
+}
+
+static std::vector<std::string> buckets[DICT_MAX_LEN + 1][DICT_MAX_LEN + 1];
+
+static void AddWord(std::string& w) {
+    int len = (int)w.size();
+    if (len < MIN_WORD_LEN || len > DICT_MAX_LEN) return;
+    for (char& c : w) {
+        if (c >= 'a' && c <= 'z') c = (char)(c - 'a' + 'A');
+        if (c < 'A' || c > 'Z') return;
+    }
+    int d = DistinctLetters(LetterMask(w.data(), len));
+    buckets[len][d].push_back(w);
+}
+
+static bool ReadList(const char* path, size_t& lines) {
+    FILE* f = std::fopen(path, "rb");
+    if (f == nullptr) return false;
+
+    std::vector<char> buf(1 << 16);
+    std::string word;
+    size_t n;
+    while ((n = std::fread(buf.data(), 1, buf.size(), f)) > 0) {
+        for (size_t i = 0; i < n; ++i) {
+            char c = buf[i];
+            if (c == '\n' || c == '\r') {
+                if (!word.empty()) { AddWord(word); lines++; }
+                word.clear();
+            } else if (word.size() <= (size_t)DICT_MAX_LEN) {
+                word.push_back(c);
+            }
+        }
+    }
+    if (!word.empty()) { AddWord(word); lines++; }
+    std::fclose(f);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: %s <out.dict> <wordlist.txt>...\n", argv[0]);
+        return 1;
+    }
+
+    size_t lines = 0;
+    for (int i = 2; i < argc; ++i) {
+        if (!ReadList(argv[i], lines)) {
+            std::fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    // Bucket table, group table, then each bucket's records in
+    // length/distinct order, grouped by letter set
+    static DictBucket table[DICT_MAX_LEN + 1][DICT_MAX_LEN + 1] = {};
+    static uint32_t groupStart[DICT_MAX_LEN + 1][DICT_MAX_LEN + 1][DICT_GROUPS] = {};
+    uint64_t offset = sizeof(DictHeader) + sizeof(table) + sizeof(groupStart);
+    uint32_t total = 0;
+    for (int len = 0; len <= DICT_MAX_LEN; ++len) {
+        for (int d = 0; d <= DICT_MAX_LEN; ++d) {
+            std::vector<std::string>& b = buckets[len][d];
+            auto group = [len](const std::string& w) { return LetterGroup(LetterMask(w.data(), len)); };
+            std::sort(b.begin(), b.end(), [&](const std::string& x, const std::string& y) {
+                uint32_t gx = group(x), gy = group(y);
+                return gx != gy ? gx < gy : x < y;
+            });
+            b.erase(std::unique(b.begin(), b.end()), b.end());
+
+            uint32_t i = 0;
+            for (int g = 0; g < DICT_GROUPS; ++g) {
+                while (i < b.size() && group(b[i]) < (uint32_t)g) ++i;
+                groupStart[len][d][g] = i;
+            }
+
+            table[len][d].offset = (uint32_t)offset;
+            table[len][d].count = (uint32_t)b.size();
+            offset += (uint64_t)b.size() * DictStride(len);
+            total += (uint32_t)b.size();
+        }
+    }
+    if (offset > UINT32_MAX) {
+        std::fprintf(stderr, "dictionary too large (%llu bytes)\n", (unsigned long long)offset);
+        return 1;
+    }
+
+    std::string tmpPath = std::string(argv[1]) + ".tmp";
+    FILE* f = std::fopen(tmpPath.c_str(), "wb");
+    if (f == nullptr) {
+        std::fprintf(stderr, "cannot write %s\n", tmpPath.c_str());
+        return 1;
+    }
+
+    DictHeader header{};
+    std::memcpy(header.magic, DICT_MAGIC, 4);
+    header.version = DICT_VERSION;
+    header.wordCount = total;
+    std::fwrite(&header, sizeof(header), 1, f);
+    std::fwrite(table, sizeof(table), 1, f);
+    std::fwrite(groupStart, sizeof(groupStart), 1, f);
+
+    unsigned char record[4 + DICT_MAX_LEN + 4];
+    for (int len = 0; len <= DICT_MAX_LEN; ++len) {
+        uint32_t stride = DictStride(len);
+        for (int d = 0; d <= DICT_MAX_LEN; ++d) {
+            for (const std::string& w : buckets[len][d]) {
+                std::memset(record, 0, sizeof(record));
+                uint32_t mask = LetterMask(w.data(), len);
+                std::memcpy(record, &mask, 4);
+                std::memcpy(record + 4, w.data(), len);
+                std::fwrite(record, stride, 1, f);
+            }
+        }
+    }
+
+    bool ok = std::fclose(f) == 0;
+    if (ok) {
+        std::remove(argv[1]);
+        ok = std::rename(tmpPath.c_str(), argv[1]) == 0;
+    }
+    if (!ok) {
+        std::fprintf(stderr, "failed to write %s\n", argv[1]);
+        std::remove(tmpPath.c_str());
+        return 1;
+    }
+
+    std::printf("%s: %u words from %zu lines\n", argv[1], total, lines);
+    return 0;
+}
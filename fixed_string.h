@@ -0,0 +1,81 @@
+#pragma once
+// String with inline storage of a compile-time byte capacity. Used for the
+// match and round state (word, hint, names) so starting a round or a series
+// copies bytes into existing buffers instead of going through the allocator;
+// a reset is just a length of zero.
+//
+// Writes past the capacity are dropped (assign stops before a partial UTF-8
+// sequence), which matches how the input fields already cap their length.
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+template <size_t N>
+class FixedString {
+public:
+    static_assert(N < 65535, "FixedString length is 16 bits");
+    static constexpr size_t CAPACITY = N; // bytes, not counting the NUL
+
+    FixedString() = default;
+    FixedString(std::string_view s) { assign(s); }
+    FixedString(const char* s) { assign(std::string_view(s)); }
+
+    FixedString& operator=(std::string_view s) {
+        assign(s);
+        return *this;
+    }
+    FixedString& operator=(const char* s) {
+        assign(std::string_view(s));
+        return *this;
+    }
+
+    void assign(std::string_view s) {
+        size_t n = s.size() < N ? s.size() : N;
+        // Don't keep the head of a code point that didn't fit
+        if (n < s.size()) {
+            while (n > 0 && ((unsigned char)s[n] & 0xC0) == 0x80) n--;
+        }
+        std::memmove(buf, s.data(), n);
+        len = (uint16_t)n;
+        buf[len] = '\0';
+    }
+
+    // False (and nothing written) when full
+    bool push_back(char c) {
+        if (len >= N) return false;
+        buf[len++] = c;
+        buf[len] = '\0';
+        return true;
+    }
+
+    void pop_back() {
+        if (len > 0) buf[--len] = '\0';
+    }
+
+    void clear() {
+        len = 0;
+        buf[0] = '\0';
+    }
+
+    size_t size() const { return len; }
+    bool empty() const { return len == 0; }
+    static constexpr size_t capacity() { return N; }
+
+    const char* c_str() const { return buf; }
+    const char* data() const { return buf; }
+    char back() const { return buf[len - 1]; }
+    char& operator[](size_t i) { return buf[i]; }
+    char operator[](size_t i) const { return buf[i]; }
+    const char* begin() const { return buf; }
+    const char* end() const { return buf + len; }
+
+    std::string_view view() const { return std::string_view(buf, len); }
+    operator std::string_view() const { return view(); }
+
+    bool operator==(std::string_view s) const { return view() == s; }
+    bool operator!=(std::string_view s) const { return view() != s; }
+
+private:
+    uint16_t len = 0;
+    char buf[N + 1] = {};
+};
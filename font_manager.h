@@ -0,0 +1,148 @@
+#pragma once
+// UI font: one signed-distance-field atlas baked from a TTF at a single base
+// size, drawn with a small SDF shader so text stays sharp at every size the
+// screens use (18-52 px) without re-rasterizing. Without a TTF the game keeps
+// raylib's built-in bitmap font.
+//
+// Text is queued through the frame and drawn by Flush() in one shader pass,
+// so all labels share a single texture bind and batch instead of switching
+// shaders per call. Nothing in the UI is drawn over text, so drawing the
+// queue after the screen's shapes keeps the same picture.
+#include "raylib.h"
+#include "alphabet.h"
+#include <cstring>
+#include <vector>
+
+static const char* const UI_FONT_FILE = "ui_font.ttf";
+
+// Atlas glyph size; the SDF is scaled from here to every drawn size
+static const int UI_FONT_BASE_SIZE = 48;
+
+// raylib's SDF example shader (GLSL 330, desktop GL)
+static const char* const SDF_FRAGMENT_SHADER =
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "out vec4 finalColor;\n"
+    "void main()\n"
+    "{\n"
+    "    float distanceFromOutline = texture(texture0, fragTexCoord).a - 0.5;\n"
+    "    float distanceChangePerFragment = length(vec2(dFdx(distanceFromOutline), dFdy(distanceFromOutline)));\n"
+    "    float alpha = smoothstep(-distanceChangePerFragment, distanceChangePerFragment, distanceFromOutline);\n"
+    "    finalColor = vec4(fragColor.rgb, fragColor.a*alpha);\n"
+    "}\n";
+
+// Glyphs the UI needs: printable ASCII plus both cases of every alphabet
+inline std::vector<int> UiFontCodepoints() {
+    std::vector<int> codepoints;
+    for (int c = 32; c < 127; ++c) codepoints.push_back(c);
+    for (int a = 0; a < (int)AlphabetId::COUNT; ++a) {
+        Alphabet::Get((AlphabetId)a).AppendGlyphs(codepoints);
+    }
+    return codepoints;
+}
+
+// CPU half of the bake (no GL): safe on the asset worker. The atlas image is
+// uploaded later by FontManager::Adopt on the main thread. Code points the
+// TTF lacks are baked as its missing-glyph box.
+inline bool BakeSdfFont(const unsigned char* ttf, int size, Font& font, Image& atlas) {
+    std::vector<int> codepoints = UiFontCodepoints();
+    font = Font{};
+    font.baseSize = UI_FONT_BASE_SIZE;
+    font.glyphCount = (int)codepoints.size();
+    font.glyphs = LoadFontData(ttf, size, font.baseSize, codepoints.data(), font.glyphCount, FONT_SDF);
+    if (font.glyphs == nullptr) {
+        font = Font{};
+        return false;
+    }
+    atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, 0, 1);
+    return true;
+}
+
+class FontManager {
+public:
+    ~FontManager() { Unload(); }
+
+    // Built-in font until a baked one arrives
+    void InitDefault() {
+        Unload();
+        font = GetFontDefault();
+    }
+
+    // Takes ownership of a font from BakeSdfFont and the atlas it came with
+    void Adopt(Font baked, Image atlas) {
+        Unload();
+        font = baked;
+        font.texture = LoadTextureFromImage(atlas);
+        UnloadImage(atlas);
+        SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
+        sdf = LoadShaderFromMemory(nullptr, SDF_FRAGMENT_SHADER);
+        owned = true;
+    }
+
+    const Font& GetFont() const { return font; }
+    bool IsSdf() const { return owned; }
+
+    // Drawn at the next Flush(); text is copied
+    void Queue(const char* text, Vector2 pos, float size, float spacing, Color color) {
+        QueuedText q;
+        q.offset = (int)chars.size();
+        q.pos = pos;
+        q.size = size;
+        q.spacing = spacing;
+        q.color = color;
+        chars.insert(chars.end(), text, text + std::strlen(text) + 1);
+        queue.push_back(q);
+    }
+
+    bool Pending() const { return !queue.empty(); }
+
+    // Everything queued, in order, under one shader
+    void Flush() {
+        if (queue.empty()) return;
+        if (owned) BeginShaderMode(sdf);
+        for (const QueuedText& q : queue) {
+            DrawTextEx(font, &chars[q.offset], q.pos, q.size, q.spacing, q.color);
+        }
+        if (owned) EndShaderMode();
+        queue.clear();
+        chars.clear();
+    }
+
+    // Immediate draw, e.g. while baking a render texture
+    void DrawNow(const char* text, Vector2 pos, float size, float spacing, Color color) const {
+        if (owned) BeginShaderMode(sdf);
+        DrawTextEx(font, text, pos, size, spacing, color);
+        if (owned) EndShaderMode();
+    }
+
+    void Unload() {
+        queue.clear();
+        chars.clear();
+        if (owned) {
+            UnloadShader(sdf);
+            UnloadFont(font);
+        }
+        font = Font{};
+        sdf = Shader{};
+        owned = false;
+    }
+
+private:
+    struct QueuedText {
+        int offset;     // into chars
+        Vector2 pos;
+        float size;
+        float spacing;
+        Color color;
+    };
+
+    Font font{};
+    Shader sdf{};
+    bool owned = false;  // baked font + shader (the default font is raylib's)
+    std::vector<QueuedText> queue;
+    std::vector<char> chars; // queued strings, NUL-separated; reused every frame
+};
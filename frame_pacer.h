@@ -0,0 +1,79 @@
+#pragma once
+// Idle-aware frame pacing. The game reports how often it needs frames; the
+// pacer switches between a full-rate loop, a low-rate loop (cursor blink,
+// network polling) and blocking on window events when nothing can change.
+// Music is fed by the audio engine's own thread and needs no frames.
+#include "raylib.h"
+#include <cstdlib>
+#include <cstring>
+
+enum class PaceMode {
+    ACTIVE, // timers/animations running: full frame rate
+    LOW,    // only slow periodic work (cursor blink, network polling)
+    IDLE    // nothing changes without input: wait for window events
+};
+
+struct FramePolicy {
+    int activeFps = 60;
+    int lowFps    = 20;  // enough for a smooth cursor blink
+
+    // --fps-active N / --fps-low N
+    void ParseArgs(int argc, char** argv) {
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--fps-active") == 0) activeFps = std::atoi(argv[++i]);
+            else if (std::strcmp(argv[i], "--fps-low") == 0) lowFps = std::atoi(argv[++i]);
+        }
+        if (activeFps < 1) activeFps = 60;
+        if (lowFps < 1) lowFps = 1;
+    }
+};
+
+class FramePacer {
+public:
+    FramePolicy policy;
+
+    unsigned long long framesRendered = 0;
+    unsigned long long framesSkipped = 0; // frames an always-on loop at activeFps would have drawn
+
+    void Apply(PaceMode mode) {
+        if (applied && mode == current) return;
+        applied = true;
+        current = mode;
+
+        switch (mode) {
+            case PaceMode::ACTIVE:
+                DisableEventWaiting();
+                SetTargetFPS(policy.activeFps);
+                break;
+            case PaceMode::LOW:
+                DisableEventWaiting();
+                SetTargetFPS(policy.lowFps);
+                break;
+            case PaceMode::IDLE:
+                // EndDrawing() now blocks in the event wait until input arrives
+                EnableEventWaiting();
+                SetTargetFPS(policy.activeFps);
+                break;
+        }
+    }
+
+    // Call once per rendered frame with that frame's duration
+    void CountFrame(float dt) {
+        framesRendered++;
+        owed += dt * policy.activeFps - 1.0;
+        if (owed >= 1.0) {
+            unsigned long long whole = (unsigned long long)owed;
+            framesSkipped += whole;
+            owed -= (double)whole;
+        } else if (owed < 0.0) {
+            owed = 0.0;
+        }
+    }
+
+    PaceMode Mode() const { return current; }
+
+private:
+    PaceMode current = PaceMode::ACTIVE;
+    bool applied = false;
+    double owed = 0.0;
+};
@@ -0,0 +1,231 @@
+#pragma once
+// Frame-time profiler. Times Update() and Draw() per screen plus a few
+// sub-sections, and counts draw submissions made through the game's draw
+// helpers (text, buttons, layer blits, the keyboard batch, hangman parts;
+// raylib merges these into fewer GPU calls). The last HISTORY frames are
+// kept for the F3 overlay (frame graph, p50/p99/max) and the F4 CSV export.
+#include "raylib.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+enum class ProfileSection : int {
+    UPDATE,
+    DRAW,
+    DRAW_HANGMAN,
+    KEYBOARD,
+    TEXT,
+    AUDIO,
+    COUNT
+};
+
+static const char* const PROFILE_SECTION_NAMES[(int)ProfileSection::COUNT] = {
+    "update", "draw", "hangman", "keyboard", "text", "audio"
+};
+
+struct ProfileFrame {
+    float frameMs = 0.0f;   // whole frame, including the wait for the next one
+    float sectionMs[(int)ProfileSection::COUNT] = {};
+    int updateScreen = -1;  // screen that ran Update() / Draw() this frame
+    int drawScreen = -1;
+    int draws = 0;
+};
+
+class FrameProfiler {
+public:
+    static const int HISTORY = 240;
+    static const int MAX_SCREENS = 8;
+
+    bool overlayVisible = false;
+
+    // Screen names for the overlay and CSV, indexed by screen id
+    void SetScreenNames(const char* const* names, int count) {
+        screenNames = names;
+        screenCount = count < MAX_SCREENS ? count : MAX_SCREENS;
+    }
+
+    // Start of Update(). lastFrameSeconds (GetFrameTime) closes the previous frame.
+    void BeginFrame(float lastFrameSeconds, int screen) {
+        if (current.updateScreen >= 0) {
+            current.frameMs = lastFrameSeconds * 1000.0f;
+            history[head] = current;
+            head = (head + 1) % HISTORY;
+            if (count < HISTORY) count++;
+        }
+        current = ProfileFrame{};
+        current.updateScreen = screen;
+    }
+
+    void SetDrawScreen(int screen) { current.drawScreen = screen; }
+    void CountDraws(int n) { current.draws += n; }
+
+    void Add(ProfileSection s, double ms) { current.sectionMs[(int)s] += (float)ms; }
+
+    struct Stats { float p50, p99, max; };
+
+    int FrameCount() const { return count; }
+
+    // Kept frames: whole-frame and CPU (Update + Draw) time; count must be > 0
+    void Summary(Stats& frame, Stats& cpu) const {
+        float f[HISTORY], c[HISTORY];
+        for (int i = 0; i < count; ++i) {
+            const ProfileFrame& fr = Frame(i);
+            f[i] = fr.frameMs;
+            c[i] = fr.sectionMs[(int)ProfileSection::UPDATE] + fr.sectionMs[(int)ProfileSection::DRAW];
+        }
+        frame = Quantiles(f);
+        cpu = Quantiles(c);
+    }
+
+    // Extra overlay line for work timed outside the frame (e.g. audio threads)
+    void SetStatus(const char* text) {
+        std::snprintf(status, sizeof(status), "%s", text);
+    }
+
+    // F4: every kept frame, oldest first
+    bool ExportCsv(const char* path) const {
+        FILE* f = std::fopen(path, "w");
+        if (f == nullptr) return false;
+
+        std::fprintf(f, "frame,update_screen,draw_screen,frame_ms");
+        for (int s = 0; s < (int)ProfileSection::COUNT; ++s) std::fprintf(f, ",%s_ms", PROFILE_SECTION_NAMES[s]);
+        std::fprintf(f, ",draws\n");
+
+        for (int i = 0; i < count; ++i) {
+            const ProfileFrame& fr = Frame(i);
+            std::fprintf(f, "%d,%s,%s,%.3f", i, ScreenName(fr.updateScreen), ScreenName(fr.drawScreen), fr.frameMs);
+            for (int s = 0; s < (int)ProfileSection::COUNT; ++s) std::fprintf(f, ",%.4f", fr.sectionMs[s]);
+            std::fprintf(f, ",%d\n", fr.draws);
+        }
+        std::fclose(f);
+        return true;
+    }
+
+    // F3 overlay, top-right; drawn after Draw() is timed so it costs nothing there
+    void DrawOverlay(int screenWidth) const {
+        const int w = 360;
+        const int x = screenWidth - w - 10;
+        const int y = 10;
+        const int lineH = 14;
+        const int graphH = 60;
+        int lines = 3 + ((int)ProfileSection::COUNT - 2) + 1 + screenCount + (status[0] ? 1 : 0);
+        int h = 10 + lines * lineH + graphH + 14;
+
+        DrawRectangle(x, y, w, h, Fade(BLACK, 0.78f));
+        if (count == 0) return;
+
+        float frame[HISTORY], cpu[HISTORY];
+        float sum[(int)ProfileSection::COUNT] = {};
+        double draws = 0.0;
+        for (int i = 0; i < count; ++i) {
+            const ProfileFrame& fr = Frame(i);
+            frame[i] = fr.frameMs;
+            cpu[i] = fr.sectionMs[(int)ProfileSection::UPDATE] + fr.sectionMs[(int)ProfileSection::DRAW];
+            for (int s = 0; s < (int)ProfileSection::COUNT; ++s) sum[s] += fr.sectionMs[s];
+            draws += fr.draws;
+        }
+
+        char buf[128];
+        int ty = y + 6;
+        auto line = [&](Color c) {
+            DrawText(buf, x + 8, ty, 10, c);
+            ty += lineH;
+        };
+
+        Stats fs = Quantiles(frame), cs = Quantiles(cpu);
+        std::snprintf(buf, sizeof(buf), "FRAME ms  p50 %6.2f  p99 %6.2f  max %6.2f", fs.p50, fs.p99, fs.max);
+        line(RAYWHITE);
+        std::snprintf(buf, sizeof(buf), "CPU   ms  p50 %6.2f  p99 %6.2f  max %6.2f", cs.p50, cs.p99, cs.max);
+        line(RAYWHITE);
+        std::snprintf(buf, sizeof(buf), "draws/frame %.1f   (%d frames)", draws / count, count);
+        line(RAYWHITE);
+
+        // Sub-sections, averaged over the history
+        for (int s = (int)ProfileSection::DRAW_HANGMAN; s < (int)ProfileSection::COUNT; ++s) {
+            std::snprintf(buf, sizeof(buf), "  %-9s %7.3f ms", PROFILE_SECTION_NAMES[s], sum[s] / count);
+            line(LIGHTGRAY);
+        }
+
+        if (status[0]) {
+            std::snprintf(buf, sizeof(buf), "%s", status);
+            line(LIGHTGRAY);
+        }
+
+        // Per screen: average Update/Draw time over the frames it was active
+        std::snprintf(buf, sizeof(buf), "%-15s %9s %9s %6s", "screen", "update", "draw", "frames");
+        line(YELLOW);
+        for (int sc = 0; sc < screenCount; ++sc) {
+            double up = 0.0, dr = 0.0;
+            int nu = 0, nd = 0;
+            for (int i = 0; i < count; ++i) {
+                const ProfileFrame& fr = Frame(i);
+                if (fr.updateScreen == sc) { up += fr.sectionMs[(int)ProfileSection::UPDATE]; nu++; }
+                if (fr.drawScreen == sc)   { dr += fr.sectionMs[(int)ProfileSection::DRAW];   nd++; }
+            }
+            std::snprintf(buf, sizeof(buf), "%-15s %9.3f %9.3f %6d", screenNames[sc],
+                          nu ? up / nu : 0.0, nd ? dr / nd : 0.0, std::max(nu, nd));
+            line(nu || nd ? RAYWHITE : GRAY);
+        }
+
+        // Frame graph: one bar per frame, scaled so 33 ms fills it; line at 16.7 ms
+        int gy = ty + 4;
+        float barW = (float)(w - 16) / HISTORY;
+        float scale = graphH / 33.3f;
+        for (int i = 0; i < count; ++i) {
+            float bh = std::min(frame[i] * scale, (float)graphH);
+            Color c = frame[i] > 17.5f ? RED : (cpu[i] > 8.0f ? ORANGE : LIME);
+            DrawRectangle(x + 8 + (int)(i * barW), gy + graphH - (int)bh, std::max(1, (int)barW), (int)bh, c);
+        }
+        int target = gy + graphH - (int)(16.7f * scale);
+        DrawLine(x + 8, target, x + w - 8, target, Fade(RAYWHITE, 0.6f));
+        DrawText("F3 hide   F4 export csv", x + 8, gy + graphH + 3, 10, GRAY);
+    }
+
+private:
+    ProfileFrame history[HISTORY];
+    int head = 0;
+    int count = 0;
+    ProfileFrame current;
+
+    const char* const* screenNames = nullptr;
+    int screenCount = 0;
+    char status[96] = {};
+
+    // i = 0 is the oldest kept frame
+    const ProfileFrame& Frame(int i) const {
+        return history[(head - count + i + HISTORY) % HISTORY];
+    }
+
+    const char* ScreenName(int screen) const {
+        return (screen >= 0 && screen < screenCount) ? screenNames[screen] : "-";
+    }
+
+    Stats Quantiles(const float* values) const {
+        float sorted[HISTORY];
+        std::copy(values, values + count, sorted);
+        std::sort(sorted, sorted + count);
+        auto at = [&](float q) { return sorted[std::min(count - 1, (int)(q * (count - 1) + 0.5f))]; };
+        return Stats{ at(0.50f), at(0.99f), sorted[count - 1] };
+    }
+};
+
+// Adds the enclosing scope's wall time to a section of the current frame
+class ProfileScope {
+public:
+    ProfileScope(FrameProfiler& profiler, ProfileSection section)
+        : profiler(profiler), section(section), start(std::chrono::steady_clock::now()) {}
+
+    ~ProfileScope() {
+        auto end = std::chrono::steady_clock::now();
+        profiler.Add(section, std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    FrameProfiler& profiler;
+    ProfileSection section;
+    std::chrono::steady_clock::time_point start;
+};
@@ -0,0 +1,29 @@
+#pragma once
+// Time source for the game logic. Live play advances it with raylib's frame
+// time, a replay with the recorded deltas (replay_log.h). Deltas are kept in
+// whole microseconds, so the recorded value is exactly the one the timers saw.
+#include <cstdint>
+
+class GameClock {
+public:
+    // Live frame time in seconds, rounded to the recorded precision
+    void Advance(float seconds) {
+        AdvanceMicros(seconds > 0.0f ? (uint32_t)(seconds * 1e6f + 0.5f) : 0u);
+    }
+
+    void AdvanceMicros(uint32_t us) {
+        dtUs = us;
+        nowUs += us;
+        frames++;
+    }
+
+    float Delta() const { return (float)dtUs * 1e-6f; }
+    uint32_t DeltaMicros() const { return dtUs; }
+    double Now() const { return (double)nowUs * 1e-6; } // seconds since the first frame
+    uint64_t Frames() const { return frames; }
+
+private:
+    uint32_t dtUs = 0;
+    uint64_t nowUs = 0;
+    uint64_t frames = 0;
+};
@@ -0,0 +1,131 @@
+#pragma once
+// The hangman figure as precomputed triangles. Parts are appended in the
+// order they appear (gallows, head, body, arms, legs, X eyes), so stage k is
+// simply the first stageEnd[k] vertices of one array: drawing any stage is a
+// single translated triangle run in raylib's shape batch, with no per-frame
+// geometry, trig or scale math.
+//
+// Built once per view scale: circle segment counts follow the on-screen
+// radius, so the head stays round when the window is scaled up.
+#include "raylib.h"
+#include "rlgl.h"
+#include <cmath>
+#include <vector>
+
+class HangmanMesh {
+public:
+    static const int STAGES = 8;                 // 0 = gallows only .. 7 = X eyes
+    static constexpr float THICKNESS = 7.0f;     // line thickness
+    static constexpr float SCALE = 1.35f;        // overall size
+
+    // viewScale: canvas -> window pixels, for circle smoothness only
+    void Build(float viewScale) {
+        if (viewScale == builtScale && !verts.empty()) return;
+        builtScale = viewScale;
+        verts.clear();
+
+        const float T = THICKNESS;
+        auto P = [](float v) { return v * SCALE; };
+
+        // Stage 0: gallows, with rounded ends on the vertical post
+        Line(0, P(120), P(120), P(120), T, BLACK);
+        Line(P(60), P(120), P(60), -P(40), T, BLACK);
+        Line(P(60), -P(40), P(130), -P(40), T, BLACK);
+        Line(P(130), -P(40), P(130), P(10), T, BLACK);
+        Circle(P(60), -P(40), T * 0.6f, BLACK);
+        Circle(P(60), P(120), T * 0.6f, BLACK);
+        stageEnd[0] = (int)verts.size();
+
+        Circle(P(130), P(10), P(18), BLACK);                  // head
+        stageEnd[1] = (int)verts.size();
+        Line(P(130), P(25), P(130), P(60), T, BLACK);         // body
+        stageEnd[2] = (int)verts.size();
+        Line(P(130), P(35), P(110), P(50), T, BLACK);         // left arm
+        stageEnd[3] = (int)verts.size();
+        Line(P(130), P(35), P(150), P(50), T, BLACK);         // right arm
+        stageEnd[4] = (int)verts.size();
+        Line(P(130), P(60), P(115), P(85), T, BLACK);         // left leg
+        stageEnd[5] = (int)verts.size();
+        Line(P(130), P(60), P(145), P(85), T, BLACK);         // right leg
+        stageEnd[6] = (int)verts.size();
+
+        // X eyes when fully hanged
+        float ox = P(130), oy = P(10);
+        Line(ox - P(8), oy - P(5), ox - P(2), oy + P(5), 3.0f, RED);
+        Line(ox - P(2), oy - P(5), ox - P(8), oy + P(5), 3.0f, RED);
+        Line(ox + P(2), oy - P(5), ox + P(8), oy + P(5), 3.0f, RED);
+        Line(ox + P(8), oy - P(5), ox + P(2), oy + P(5), 3.0f, RED);
+        stageEnd[7] = (int)verts.size();
+    }
+
+    // Figure anchored at (x, y), the same anchor the gallows were drawn from
+    void Draw(int stage, float x, float y) const {
+        if (verts.empty()) return;
+        if (stage < 0) stage = 0;
+        if (stage >= STAGES) stage = STAGES - 1;
+
+        rlPushMatrix();
+        rlTranslatef(x, y, 0.0f);
+        rlBegin(RL_TRIANGLES);
+        for (int i = 0; i < stageEnd[stage]; ++i) {
+            const Vertex& v = verts[i];
+            rlColor4ub(v.color.r, v.color.g, v.color.b, v.color.a);
+            rlVertex2f(v.x, v.y);
+        }
+        rlEnd();
+        rlPopMatrix();
+    }
+
+    int VertexCount(int stage) const { return stageEnd[stage]; }
+
+private:
+    struct Vertex {
+        float x, y;
+        Color color;
+    };
+
+    std::vector<Vertex> verts;
+    int stageEnd[STAGES] = {};
+    float builtScale = 0.0f;
+
+    // raylib culls clockwise-on-screen triangles; keep the order it draws shapes in
+    void Tri(Vector2 a, Vector2 b, Vector2 c, Color color) {
+        float cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        if (cross > 0.0f) { Vector2 t = b; b = c; c = t; }
+        verts.push_back({ a.x, a.y, color });
+        verts.push_back({ b.x, b.y, color });
+        verts.push_back({ c.x, c.y, color });
+    }
+
+    // Same quad as DrawLineEx: thickness across the segment, no caps
+    void Line(float x0, float y0, float x1, float y1, float thick, Color color) {
+        float dx = x1 - x0, dy = y1 - y0;
+        float len = std::sqrt(dx * dx + dy * dy);
+        if (len <= 0.0f) return;
+        float nx = -dy / len * thick * 0.5f;
+        float ny =  dx / len * thick * 0.5f;
+
+        Vector2 a = { x0 + nx, y0 + ny }, b = { x0 - nx, y0 - ny };
+        Vector2 c = { x1 - nx, y1 - ny }, d = { x1 + nx, y1 + ny };
+        Tri(a, b, c, color);
+        Tri(a, c, d, color);
+    }
+
+    // Triangle fan; about one segment per 2 window pixels of circumference
+    void Circle(float cx, float cy, float radius, Color color) {
+        float onScreen = radius * builtScale;
+        int segments = (int)(2.0f * PI * onScreen / 2.0f);
+        if (segments < 12) segments = 12;
+        if (segments > 96) segments = 96;
+
+        Vector2 center = { cx, cy };
+        for (int i = 0; i < segments; ++i) {
+            float a0 = 2.0f * PI * i / segments;
+            float a1 = 2.0f * PI * (i + 1) / segments;
+            Tri(center,
+                Vector2{ cx + std::cos(a0) * radius, cy + std::sin(a0) * radius },
+                Vector2{ cx + std::cos(a1) * radius, cy + std::sin(a1) * radius },
+                color);
+        }
+    }
+};
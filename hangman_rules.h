@@ -0,0 +1,504 @@
+#pragma once
+// Game rules for Hangman, kept free of raylib so the same state machine can
+// drive the windowed game and the headless simulator.
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "alphabet.h"
+#include "fixed_string.h"
+
+// Input limits, in characters (code points); storage is sized from them
+static const int WORD_MAX_CHARS = 20;
+static const int HINT_MAX_CHARS = 40;
+static const int NAME_MAX_CHARS = 15;   // ASCII (leaderboard records hold 15 + NUL)
+
+// Up to 4 UTF-8 bytes per character
+using WordString = FixedString<WORD_MAX_CHARS * 4>;
+using HintString = FixedString<HINT_MAX_CHARS * 4>;
+using NameString = FixedString<NAME_MAX_CHARS>;
+
+// ---------------- Rule helpers ----------------
+// Words are UTF-8. A word is valid with at least one letter of the alphabet
+// and no letters of another one (they could never be guessed); spaces,
+// digits and punctuation are allowed and shown from the start.
+inline bool WordValid(std::string_view w, AlphabetId alphabet = AlphabetId::ENGLISH) {
+    const Alphabet &a = Alphabet::Get(alphabet);
+    bool any = false;
+    for (size_t i = 0; i < w.size();) {
+        uint32_t cp = Utf8Next(w, i);
+        if (a.IndexOf(cp) >= 0) any = true;
+        else if (cp == 0xFFFD || IsAlphabetLetter(cp)) return false;
+    }
+    return any;
+}
+
+// A word and hint from the other side of a connection must fit what the
+// entry screen accepts; the authority drops anything StartRound would cut
+inline bool WordEntryFits(std::string_view word, std::string_view hint) {
+    return !hint.empty() && word.size() <= WordString::CAPACITY && Utf8Length(word) <= WORD_MAX_CHARS &&
+           hint.size() <= HintString::CAPACITY && Utf8Length(hint) <= HINT_MAX_CHARS;
+}
+
+// Hidden form of a word: letters become '*', everything else stays
+template <class Out>
+inline void MaskWord(std::string_view word, Out &shown, AlphabetId alphabet = AlphabetId::ENGLISH) {
+    const Alphabet &a = Alphabet::Get(alphabet);
+    shown.clear();
+    for (size_t i = 0; i < word.size();) {
+        uint32_t cp = Utf8Next(word, i);
+        Utf8Append(shown, a.IndexOf(cp) >= 0 ? (uint32_t)'*' : cp);
+    }
+}
+
+// Pretty print a shown word as "A _ _" into a fixed buffer (visual only)
+inline void SpacedWord(std::string_view s, char *out, int capacity) {
+    int n = 0;
+    for (size_t i = 0; i < s.size();) {
+        size_t from = i;
+        uint32_t cp = Utf8Next(s, i);
+        int bytes = (int)(i - from);
+        if (n + bytes + 1 >= capacity) break;
+        if (cp == '*') {
+            out[n++] = '_';
+        } else {
+            for (size_t k = from; k < i; ++k) out[n++] = s[k];
+        }
+        out[n++] = ' ';
+    }
+    out[n] = '\0';
+}
+
+// ---------------- Letter engine ----------------
+// Built once when the word is entered: which letters were tried (one bit per
+// alphabet index), where each letter sits in the secret word (code point
+// positions), and how many letters are still hidden. Guesses then touch only
+// the positions of that letter. Everything is inline: a word never has more
+// than WORD_MAX_CHARS positions.
+struct LetterEngine {
+    uint64_t triedMask = 0;
+    int hiddenCount = 0;
+
+    // Positions of letter L are positions[start[L] .. start[L + 1])
+    uint16_t start[Alphabet::MAX_LETTERS + 1] = {};
+    uint8_t positions[WORD_MAX_CHARS] = {};
+
+    void Clear() {
+        triedMask = 0;
+        hiddenCount = 0;
+        std::fill(start, start + Alphabet::MAX_LETTERS + 1, (uint16_t)0);
+    }
+
+    void Build(const uint32_t *word, int length, const Alphabet &alphabet) {
+        Clear();
+
+        // Counting sort of positions by letter index
+        uint16_t count[Alphabet::MAX_LETTERS] = {};
+        for (int i = 0; i < length; ++i) {
+            int l = alphabet.IndexOfFolded(word[i]);
+            if (l >= 0) count[l]++;
+        }
+        for (int l = 0; l < Alphabet::MAX_LETTERS; ++l) {
+            start[l + 1] = (uint16_t)(start[l] + count[l]);
+        }
+        hiddenCount = start[Alphabet::MAX_LETTERS];
+
+        uint16_t fill[Alphabet::MAX_LETTERS];
+        std::copy(start, start + Alphabet::MAX_LETTERS, fill);
+        for (int i = 0; i < length; ++i) {
+            int l = alphabet.IndexOfFolded(word[i]);
+            if (l >= 0) positions[fill[l]++] = (uint8_t)i;
+        }
+    }
+
+    bool IsTried(int l) const { return (triedMask >> l) & 1u; }
+    int Count(int l) const { return start[l + 1] - start[l]; }
+};
+
+// ---------------- Settings (user-configurable) ----------------
+// How a finished round is scored (see the scoring policies below)
+enum class ScoringRule : uint8_t {
+    CLASSIC,      // +1 to whoever won the round
+    LIVES_LEFT,   // guesser earns the lives it had left; setter +1 on a loss
+    COUNT
+};
+
+static const char* const SCORING_NAMES[(int)ScoringRule::COUNT] = { "classic", "lives-left" };
+
+struct MatchSettings {
+    static const int MAX_ROUNDS = 10;
+
+    bool starterIsP1 = true;
+    int totalRounds = 3;
+    int maxLivesSetting = 7;      // max wrong guesses (RuntimeLives range)
+    int timeLimitSeconds = 60;    // default 60s per word (RuntimeTimer range)
+    bool swapRoles = true;        // setter and guesser trade places each round
+    AlphabetId alphabet = AlphabetId::ENGLISH; // letters words are made of
+    ScoringRule scoring = ScoringRule::CLASSIC;
+};
+
+// ---------------- Rule policies ----------------
+// A match is BasicMatch<Scoring, Timer, Lives>. Each policy is a set of
+// static functions of the settings; the fixed ones are constexpr, so a build
+// that picks them (headless sim, solver eval, server) gets the limits as
+// immediates and the unused branches folded away. The game uses the Runtime*
+// policies, which read MatchSettings.
+
+// Points for the setter and the guesser when a round ends
+struct ScoreAward {
+    int setter;
+    int guesser;
+};
+
+struct ClassicScoring {
+    static constexpr ScoreAward Award(const MatchSettings &, bool guesserWon, int, int) {
+        return guesserWon ? ScoreAward{ 0, 1 } : ScoreAward{ 1, 0 };
+    }
+};
+
+struct LivesLeftScoring {
+    static constexpr ScoreAward Award(const MatchSettings &, bool guesserWon, int wrongGuesses, int maxLives) {
+        return guesserWon ? ScoreAward{ 0, maxLives - wrongGuesses } : ScoreAward{ 1, 0 };
+    }
+};
+
+// The only place the game branches on the scoring variant
+struct RuntimeScoring {
+    static ScoreAward Award(const MatchSettings &s, bool guesserWon, int wrongGuesses, int maxLives) {
+        switch (s.scoring) {
+            case ScoringRule::LIVES_LEFT: return LivesLeftScoring::Award(s, guesserWon, wrongGuesses, maxLives);
+            default:                      return ClassicScoring::Award(s, guesserWon, wrongGuesses, maxLives);
+        }
+    }
+};
+
+// Round clock
+struct RuntimeTimer {
+    static const int MIN_SECONDS = 10;
+    static const int MAX_SECONDS = 300;
+    static const int STEP_SECONDS = 10;   // settings screen step
+    static constexpr bool ENABLED = true;
+    static float Limit(const MatchSettings &s) { return (float)s.timeLimitSeconds; }
+};
+
+template <int Seconds>
+struct FixedTimer {
+    static constexpr bool ENABLED = true;
+    static constexpr float Limit(const MatchSettings &) { return (float)Seconds; }
+};
+
+// No clock at all: Tick() compiles to nothing
+struct NoTimer {
+    static constexpr bool ENABLED = false;
+    static constexpr float Limit(const MatchSettings &) { return 0.0f; }
+};
+
+// Wrong guesses allowed
+struct RuntimeLives {
+    static const int MIN_LIVES = 1;
+    static const int MAX_LIVES = 7;       // hangman drawing stages
+    static int Max(const MatchSettings &s) { return s.maxLivesSetting; }
+};
+
+template <int N>
+struct FixedLives {
+    static constexpr int Max(const MatchSettings &) { return N; }
+};
+
+// Keeps runtime settings inside the ranges the runtime policies support
+inline void ClampSettings(MatchSettings &s) {
+    s.totalRounds = std::min(std::max(s.totalRounds, 1), MatchSettings::MAX_ROUNDS);
+    s.maxLivesSetting = std::min(std::max(s.maxLivesSetting, RuntimeLives::MIN_LIVES), RuntimeLives::MAX_LIVES);
+    s.timeLimitSeconds = std::min(std::max(s.timeLimitSeconds, RuntimeTimer::MIN_SECONDS), RuntimeTimer::MAX_SECONDS);
+}
+
+// --scoring NAME (the game; the server is built with classic scoring)
+struct RuleOptions {
+    ScoringRule scoring = ScoringRule::CLASSIC;
+
+    void ParseArgs(int argc, char **argv) {
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--scoring") != 0) continue;
+            for (int r = 0; r < (int)ScoringRule::COUNT; ++r) {
+                if (std::strcmp(argv[i + 1], SCORING_NAMES[r]) == 0) scoring = (ScoringRule)r;
+            }
+        }
+    }
+};
+
+// What a single guess did to the round
+enum class GuessResult {
+    ALREADY_TRIED, // letter was guessed before (or round is over)
+    HIT,           // letter is in the word, round continues
+    MISS,          // letter not in word, round continues
+    WON,           // last hidden letter revealed
+    LOST           // out of lives
+};
+
+// ---------------- Match state machine ----------------
+// One two-player series: roles, scores, and the current round.
+template <class Scoring, class Timer, class Lives>
+class BasicMatch {
+public:
+    MatchSettings settings;
+
+    // Series state
+    bool player1IsSetter = true;
+    int currentRound = 1;
+    int player1Score = 0;
+    int player2Score = 0;
+
+    // Round state, all inline (no heap; a reset is a few stores). The word is
+    // kept as folded code points; shownWord is its UTF-8 form with '*' for
+    // hidden letters (what the UI and solver read).
+    WordString secretWord;
+    HintString hint;
+    WordString shownWord;
+    uint32_t secretCodes[WORD_MAX_CHARS] = {};
+    uint32_t shownCodes[WORD_MAX_CHARS] = {};
+    int wordLength = 0;    // code points
+    LetterEngine letters;
+    int lives = 0;
+    bool gameOver = false;
+    bool win = false;
+    float timeLeft = 0.0f;
+    int roundSerial = 0;   // bumped every StartRound (lets callers cache per-round data)
+    ScoreAward lastAward{ 0, 0 }; // what AwardScore gave when the round ended
+
+    // Fresh series using the current settings
+    void StartMatch() {
+        player1IsSetter = settings.starterIsP1;
+        player1Score = 0;
+        player2Score = 0;
+        currentRound = 1;
+        ResetRound();
+    }
+
+    void ResetRound() {
+        lastAward = ScoreAward{ 0, 0 };
+        secretWord.clear();
+        hint.clear();
+        shownWord.clear();
+        wordLength = 0;
+        letters.Clear();
+        lives = 0;
+        gameOver = false;
+        win = false;
+        timeLeft = Timer::Limit(settings);
+    }
+
+    int MaxLives() const { return Lives::Max(settings); }
+
+    // Setter has chosen the word: mask it and start the clock
+    // Words over WORD_MAX_CHARS are cut there (the input fields stop earlier)
+    void StartRound(std::string_view word, std::string_view wordHint) {
+        const Alphabet &a = GetAlphabet();
+        hint = wordHint;
+
+        secretWord.clear();
+        wordLength = 0;
+        for (size_t i = 0; i < word.size() && wordLength < WORD_MAX_CHARS;) {
+            uint32_t cp = FoldCase(Utf8Next(word, i));
+            Utf8Append(secretWord, cp);
+            secretCodes[wordLength] = cp;
+            shownCodes[wordLength] = a.IndexOfFolded(cp) >= 0 ? (uint32_t)'*' : cp;
+            wordLength++;
+        }
+        EncodeShown();
+
+        letters.Build(secretCodes, wordLength, a);
+        roundSerial++;
+        lastAward = ScoreAward{ 0, 0 };
+        lives = 0;
+        gameOver = false;
+        win = false;
+        timeLeft = Timer::Limit(settings);
+    }
+
+    // Round resumed from a session snapshot: same word, the tried letters
+    // shown again, nothing scored (the snapshot carries the scores)
+    void RestoreRound(std::string_view word, std::string_view wordHint, uint64_t triedMask,
+                      int wrongGuesses, float time, bool over, bool won) {
+        StartRound(word, wordHint);
+        letters.triedMask = triedMask;
+        for (int l = 0; l < GetAlphabet().Size(); ++l) {
+            if (!letters.IsTried(l)) continue;
+            for (int k = letters.start[l]; k < letters.start[l + 1]; ++k) {
+                int i = letters.positions[k];
+                shownCodes[i] = secretCodes[i];
+            }
+            letters.hiddenCount -= letters.Count(l);
+        }
+        EncodeShown();
+        lives = wrongGuesses;
+        timeLeft = time;
+        gameOver = over;
+        win = won;
+    }
+
+    const Alphabet &GetAlphabet() const { return Alphabet::Get(settings.alphabet); }
+
+    bool IsTried(uint32_t letter) const {
+        int l = GetAlphabet().IndexOf(letter);
+        return l >= 0 && letters.IsTried(l);
+    }
+
+    // Guess a letter of the round's alphabet (either case)
+    GuessResult ProcessGuess(uint32_t letter) {
+        int l = GetAlphabet().IndexOf(letter);
+        if (gameOver || l < 0 || letters.IsTried(l)) return GuessResult::ALREADY_TRIED;
+        letters.triedMask |= 1ull << l;
+
+        // Reveal only the positions holding this letter
+        if (letters.Count(l) > 0) {
+            for (int k = letters.start[l]; k < letters.start[l + 1]; ++k) {
+                int i = letters.positions[k];
+                shownCodes[i] = secretCodes[i];
+            }
+            EncodeShown();
+        }
+
+        if (letters.Count(l) == 0) {
+            lives++;
+            if (lives >= Lives::Max(settings)) {
+                gameOver = true;
+                win = false;
+                AwardScore(false);
+                return GuessResult::LOST;
+            }
+            return GuessResult::MISS;
+        }
+
+        letters.hiddenCount -= letters.Count(l);
+        if (letters.hiddenCount == 0) {
+            gameOver = true;
+            win = true;
+            AwardScore(true);
+            return GuessResult::WON;
+        }
+        return GuessResult::HIT;
+    }
+
+    // Advance the round timer; returns true on the tick the time runs out
+    bool Tick(float dt) {
+        if (!Timer::ENABLED || gameOver) return false;
+        timeLeft -= dt;
+        if (timeLeft <= 0.0f) {
+            TimeOut();
+            return true;
+        }
+        return false;
+    }
+
+    // Round clock ran out (for callers that keep time themselves)
+    void TimeOut() {
+        if (gameOver) return;
+        timeLeft = 0.0f;
+        gameOver = true;
+        win = false;
+        AwardScore(false);
+    }
+
+    // Positions holding a letter in the secret word (bit i = code point i)
+    uint32_t PositionMask(uint32_t letter) const {
+        int l = GetAlphabet().IndexOf(letter);
+        uint32_t mask = 0;
+        if (l < 0) return mask;
+        for (int k = letters.start[l]; k < letters.start[l + 1]; ++k) {
+            mask |= 1u << letters.positions[k];
+        }
+        return mask;
+    }
+
+    // Positions shown from the start (spaces)
+    uint32_t SpaceMask() const {
+        uint32_t mask = 0;
+        for (int i = 0; i < wordLength; ++i) {
+            if (shownCodes[i] != '*') mask |= 1u << i;
+        }
+        return mask;
+    }
+
+    // ---- Mirror of a round run elsewhere (networked play) ----
+    // The secret word stays unknown until ApplyRoundEnd.
+
+    // length is in code points
+    void StartRemoteRound(int length, uint32_t spaceMask, std::string_view wordHint, float time) {
+        secretWord.clear();
+        hint = wordHint;
+        wordLength = std::min(std::max(length, 0), WORD_MAX_CHARS);
+        letters.Clear();
+        for (int i = 0; i < wordLength; ++i) {
+            if ((spaceMask >> i) & 1u) {
+                shownCodes[i] = ' ';
+            } else {
+                shownCodes[i] = '*';
+                letters.hiddenCount++;
+            }
+        }
+        EncodeShown();
+        roundSerial++;
+        lives = 0;
+        gameOver = false;
+        win = false;
+        timeLeft = time;
+    }
+
+    void ApplyReveal(uint32_t letter, uint32_t positions, int wrongGuesses, GuessResult result) {
+        const Alphabet &a = GetAlphabet();
+        int l = a.IndexOf(letter);
+        if (l < 0) return;
+        letters.triedMask |= 1ull << l;
+        for (int i = 0; i < wordLength; ++i) {
+            if ((positions >> i) & 1u) {
+                shownCodes[i] = a.Letter(l);
+                letters.hiddenCount--;
+            }
+        }
+        if (positions != 0) EncodeShown();
+        lives = wrongGuesses;
+        if (result == GuessResult::WON || result == GuessResult::LOST) {
+            gameOver = true;
+            win = (result == GuessResult::WON);
+        }
+    }
+
+    void ApplyRoundEnd(bool guesserWon, int p1Score, int p2Score, std::string_view word) {
+        gameOver = true;
+        win = guesserWon;
+        player1Score = p1Score;
+        player2Score = p2Score;
+        secretWord = word;
+    }
+
+    void AwardScore(bool guesserWon) {
+        ScoreAward a = Scoring::Award(settings, guesserWon, lives, Lives::Max(settings));
+        lastAward = a;
+        int &setterScore  = player1IsSetter ? player1Score : player2Score;
+        int &guesserScore = player1IsSetter ? player2Score : player1Score;
+        setterScore += a.setter;
+        guesserScore += a.guesser;
+    }
+
+    // Returns true if another round was set up, false when the series is over
+    bool AdvanceRound() {
+        if (currentRound < settings.totalRounds) {
+            currentRound++;
+            if (settings.swapRoles) player1IsSetter = !player1IsSetter;
+            ResetRound();
+            return true;
+        }
+        return false;
+    }
+
+private:
+    // shownCodes -> shownWord
+    void EncodeShown() {
+        shownWord.clear();
+        for (int i = 0; i < wordLength; ++i) Utf8Append(shownWord, shownCodes[i]);
+    }
+};
+
+// The game: every rule read from MatchSettings
+using HangmanMatch = BasicMatch<RuntimeScoring, RuntimeTimer, RuntimeLives>;
@@ -0,0 +1,597 @@
+// Dedicated match server (Linux): hosts many independent two-player series
+// for games started with --join. Speaks the same protocol as a hosting
+// game (net_protocol.h) and runs the same rules (hangman_rules.h).
+//
+// The main thread accepts connections and pairs them; each pair becomes a
+// room on one of a few worker threads, so a room is only ever touched by
+// its worker. A worker is one epoll loop over its rooms' sockets, with the
+// rooms in a fixed-capacity arena and every round clock (expiry plus the
+// once-a-second TIMER_SYNC) in one timer wheel instead of per-room polling.
+//
+// Usage: hangman_server [--port P] [--threads N] [--rooms N]
+//                       [--rounds N] [--lives N] [--time S]
+//                       [--alphabet english|latin|greek|cyrillic]
+#include "hangman_rules.h"
+#include "net_protocol.h"
+#include "timer_wheel.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <strings.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const uint32_t TICK_MS = 10;          // timer wheel resolution
+static const uint64_t SYNC_TICKS = 1000 / TICK_MS;
+static const uint64_t LINGER_TICKS = 30000 / TICK_MS; // finished room kept for its summary screen
+static const uint64_t WAKE_KEY = ~0ull;      // epoll key of a worker's eventfd
+static const size_t MAX_BACKLOG = 4096;      // unsent bytes per connection (~15 full frames)
+
+// Rounds, lives and time come from the command line; scoring is fixed here
+using ServerMatch = BasicMatch<ClassicScoring, RuntimeTimer, RuntimeLives>;
+
+struct ServerConfig {
+    int port = 5000;
+    int threads = 4;
+    uint32_t roomsPerWorker = 2048;
+    MatchSettings settings;
+};
+
+static uint64_t NowMs() {
+    using namespace std::chrono;
+    return (uint64_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void ConfigureSocket(int fd) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+// ---------------- Room arena ----------------
+// One up-front block of capacity slots; rooms are constructed in place on
+// Alloc and destroyed on Free, and free slots are a stack of indices.
+template <class T>
+class Arena {
+public:
+    explicit Arena(uint32_t capacity)
+        : storage(new Slot[capacity]), capacity(capacity) {
+        freeList.reserve(capacity);
+        for (uint32_t i = capacity; i > 0; --i) freeList.push_back(i - 1);
+    }
+
+    ~Arena() {
+        for (uint32_t i = 0; i < capacity; ++i) {
+            if (storage[i].used) Get(i)->~T();
+        }
+    }
+
+    T* Alloc(uint32_t& index) {
+        if (freeList.empty()) return nullptr;
+        index = freeList.back();
+        freeList.pop_back();
+        storage[index].used = true;
+        return new (storage[index].bytes) T();
+    }
+
+    void Free(uint32_t index) {
+        Get(index)->~T();
+        storage[index].used = false;
+        freeList.push_back(index);
+    }
+
+    T* Get(uint32_t index) { return std::launder(reinterpret_cast<T*>(storage[index].bytes)); }
+    uint32_t Live() const { return capacity - (uint32_t)freeList.size(); }
+
+private:
+    struct Slot {
+        alignas(T) unsigned char bytes[sizeof(T)];
+        bool used = false;
+    };
+    std::unique_ptr<Slot[]> storage;
+    uint32_t capacity;
+    std::vector<uint32_t> freeList;
+};
+
+// ---------------- Rooms ----------------
+struct Conn {
+    int fd = -1;
+    FrameReader reader;
+    std::vector<uint8_t> out;
+    bool writeArmed = false; // EPOLLOUT registered
+    bool hello = false;
+    std::string name;
+};
+
+enum class RoomState { WAIT_HELLO, WAIT_WORD, PLAYING, FINISHED };
+
+struct Room {
+    RoomState state = RoomState::WAIT_HELLO;
+    Conn players[2];                    // [0] is player 1
+    ServerMatch match;
+    TimerWheel::Handle expiry = TimerWheel::NONE; // round expiry, then the linger once FINISHED
+    TimerWheel::Handle sync = TimerWheel::NONE;
+    uint64_t deadline = 0;              // tick the round clock runs out
+    bool closed = false;                // sockets gone, slot freed after this epoll batch
+
+    int SetterSide() const { return match.player1IsSetter ? 0 : 1; }
+    int GuesserSide() const { return 1 - SetterSide(); }
+};
+
+enum TimerKind : uint64_t { TIMER_EXPIRY = 0, TIMER_SYNC = 1, TIMER_LINGER = 2 };
+
+static uint64_t TimerData(uint32_t index, TimerKind kind) { return ((uint64_t)index << 2) | kind; }
+
+class Worker {
+public:
+    std::atomic<uint32_t> liveRooms{ 0 };
+    std::atomic<uint64_t> seriesPlayed{ 0 };
+
+    Worker(const ServerConfig& config)
+        : config(config), rooms(config.roomsPerWorker), startMs(NowMs()) {
+        epfd = epoll_create1(0);
+        wakeFd = eventfd(0, EFD_NONBLOCK);
+        epoll_event ev{};
+        ev.events = EPOLLIN;
+        ev.data.u64 = WAKE_KEY;
+        epoll_ctl(epfd, EPOLL_CTL_ADD, wakeFd, &ev);
+    }
+
+    // Acceptor thread: hand over a pair of connected players
+    void Adopt(int fdP1, int fdP2) {
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            pending.push_back({ fdP1, fdP2 });
+        }
+        uint64_t one = 1;
+        ssize_t n = write(wakeFd, &one, sizeof(one));
+        (void)n;
+    }
+
+    void Run() {
+        epoll_event events[256];
+        for (;;) {
+            int timeout = wheel.Pending() > 0 ? (int)TICK_MS : 1000;
+            int n = epoll_wait(epfd, events, 256, timeout);
+            for (int i = 0; i < n; ++i) {
+                uint64_t key = events[i].data.u64;
+                if (key == WAKE_KEY) {
+                    TakePending();
+                } else {
+                    OnSocket((uint32_t)(key >> 1), (int)(key & 1), events[i].events);
+                }
+            }
+            wheel.Advance(NowTick(), [this](uint64_t data) { OnTimer(data); });
+            ReleaseClosed();
+        }
+    }
+
+private:
+    const ServerConfig& config;
+    Arena<Room> rooms;
+    TimerWheel wheel;
+    uint64_t startMs;
+    int epfd = -1;
+    int wakeFd = -1;
+
+    std::mutex pendingMutex;
+    std::vector<std::pair<int, int>> pending;
+
+    // Rooms closed during the current batch. Their slots are only reused
+    // afterwards, so a later event in the same batch can't reach a new room.
+    std::vector<uint32_t> closing;
+
+    uint64_t NowTick() const { return (NowMs() - startMs) / TICK_MS; }
+
+    void TakePending() {
+        uint64_t count;
+        ssize_t r = read(wakeFd, &count, sizeof(count));
+        (void)r;
+
+        std::vector<std::pair<int, int>> pairs;
+        {
+            std::lock_guard<std::mutex> lock(pendingMutex);
+            pairs.swap(pending);
+        }
+        for (const auto& p : pairs) OpenRoom(p.first, p.second);
+    }
+
+    void OpenRoom(int fdP1, int fdP2) {
+        uint32_t index;
+        Room* room = rooms.Alloc(index);
+        if (room == nullptr) { // full: turn both away
+            close(fdP1);
+            close(fdP2);
+            return;
+        }
+        liveRooms++;
+
+        int fds[2] = { fdP1, fdP2 };
+        for (int side = 0; side < 2; ++side) {
+            ConfigureSocket(fds[side]);
+            room->players[side].fd = fds[side];
+            epoll_event ev{};
+            ev.events = EPOLLIN;
+            ev.data.u64 = ((uint64_t)index << 1) | (uint64_t)side;
+            epoll_ctl(epfd, EPOLL_CTL_ADD, fds[side], &ev);
+        }
+        room->match.settings = config.settings;
+    }
+
+    void CloseRoom(uint32_t index) {
+        Room* room = rooms.Get(index);
+        if (room->closed) return;
+        room->closed = true;
+        closing.push_back(index);
+        wheel.Cancel(room->expiry);
+        wheel.Cancel(room->sync);
+        for (Conn& c : room->players) {
+            if (c.fd >= 0) {
+                epoll_ctl(epfd, EPOLL_CTL_DEL, c.fd, nullptr);
+                close(c.fd);
+                c.fd = -1;
+            }
+        }
+    }
+
+    void ReleaseClosed() {
+        for (uint32_t index : closing) {
+            rooms.Free(index);
+            liveRooms--;
+        }
+        closing.clear();
+    }
+
+    // ---- I/O ----
+
+    void OnSocket(uint32_t index, int side, uint32_t events) {
+        Room* room = rooms.Get(index);
+        Conn& c = room->players[side];
+        if (room->closed) return;
+
+        if (events & (EPOLLERR | EPOLLHUP)) {
+            CloseRoom(index);
+            return;
+        }
+        if ((events & EPOLLOUT) && !Flush(index, side)) return;
+        if (!(events & EPOLLIN)) return;
+
+        uint8_t chunk[1024];
+        for (;;) {
+            ssize_t n = recv(c.fd, chunk, sizeof(chunk), 0);
+            if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)) {
+                CloseRoom(index);
+                return;
+            }
+            if (n < 0) break;
+            if (!c.reader.Feed(chunk, (int)n)) {
+                CloseRoom(index);
+                return;
+            }
+
+            uint8_t type;
+            const uint8_t* payload;
+            int size;
+            while (c.reader.Next(type, payload, size)) {
+                NetMessage m;
+                if (!DecodeMessage(type, payload, size, m) || !OnMessage(index, side, m)) {
+                    CloseRoom(index);
+                    return;
+                }
+                if (room->closed) return; // a send inside failed
+            }
+        }
+    }
+
+    // Queues and tries to write now; false if the room was closed
+    bool Send(uint32_t index, int side, const NetMessage& m) {
+        Room* room = rooms.Get(index);
+        if (room->closed) return false;
+        Conn& c = room->players[side];
+        uint8_t frame[NET_MAX_FRAME];
+        int n = EncodeMessage(m, frame);
+        c.out.insert(c.out.end(), frame, frame + n);
+        return Flush(index, side);
+    }
+
+    bool SendBoth(uint32_t index, const NetMessage& m) {
+        return Send(index, 0, m) && Send(index, 1, m);
+    }
+
+    bool Flush(uint32_t index, int side) {
+        Room* room = rooms.Get(index);
+        Conn& c = room->players[side];
+        if (room->closed) return false;
+        size_t sent = 0;
+        while (sent < c.out.size()) {
+            ssize_t n = send(c.fd, c.out.data() + sent, c.out.size() - sent, MSG_NOSIGNAL);
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) break;
+            if (n <= 0) {
+                CloseRoom(index);
+                return false;
+            }
+            sent += (size_t)n;
+        }
+        c.out.erase(c.out.begin(), c.out.begin() + (ptrdiff_t)sent);
+
+        // A peer that stops reading would otherwise grow the queue forever
+        if (c.out.size() > MAX_BACKLOG) {
+            CloseRoom(index);
+            return false;
+        }
+
+        // Only wait for writability while there is a backlog
+        bool wantWrite = !c.out.empty();
+        if (wantWrite != c.writeArmed) {
+            epoll_event ev{};
+            ev.events = EPOLLIN | (wantWrite ? EPOLLOUT : 0u);
+            ev.data.u64 = ((uint64_t)index << 1) | (uint64_t)side;
+            epoll_ctl(epfd, EPOLL_CTL_MOD, c.fd, &ev);
+            c.writeArmed = wantWrite;
+        }
+        return true;
+    }
+
+    // ---- Rules ----
+
+    // False drops the room (protocol violation)
+    bool OnMessage(uint32_t index, int side, const NetMessage& m) {
+        Room* room = rooms.Get(index);
+        ServerMatch& match = room->match;
+
+        switch (m.type) {
+            case NetMsg::PING: {
+                NetMessage pong;
+                pong.type = NetMsg::PONG;
+                pong.stamp = m.stamp;
+                Send(index, side, pong);
+                return true;
+            }
+            case NetMsg::PONG:
+                return true;
+
+            case NetMsg::HELLO: {
+                Conn& c = room->players[side];
+                if (c.hello) return true;
+                c.hello = true;
+                c.name = m.text.substr(0, 15);
+                if (room->players[0].hello && room->players[1].hello) StartSeries(index);
+                return true;
+            }
+
+            case NetMsg::SET_WORD: {
+                if (room->state != RoomState::WAIT_WORD || side != room->SetterSide()) return true;
+                if (!WordValid(m.text, match.settings.alphabet) || !WordEntryFits(m.text, m.text2)) return true;
+                match.StartRound(m.text, m.text2);
+                StartClock(index);
+
+                NetMessage start;
+                start.type = NetMsg::ROUND_START;
+                start.length = (uint8_t)match.wordLength;
+                start.mask = match.SpaceMask();
+                start.timeCs = (uint32_t)match.settings.timeLimitSeconds * 100;
+                start.text = match.hint;
+                SendBoth(index, start);
+                return true;
+            }
+
+            case NetMsg::GUESS: {
+                if (room->state != RoomState::PLAYING || side != room->GuesserSide()) return true;
+                GuessResult result = match.ProcessGuess(m.letter);
+                if (result == GuessResult::ALREADY_TRIED) return true;
+
+                NetMessage reveal;
+                reveal.type = NetMsg::REVEAL;
+                reveal.letter = (uint16_t)FoldCase(m.letter);
+                reveal.mask = match.PositionMask(m.letter);
+                reveal.lives = (uint8_t)match.lives;
+                reveal.result = (uint8_t)result;
+                if (!SendBoth(index, reveal)) return true;
+                if (match.gameOver) EndRound(index);
+                return true;
+            }
+
+            default:
+                return false; // authority-only messages from a player
+        }
+    }
+
+    void StartSeries(uint32_t index) {
+        Room* room = rooms.Get(index);
+        room->match.StartMatch();
+        room->state = RoomState::WAIT_WORD;
+
+        for (int side = 0; side < 2; ++side) {
+            NetMessage m;
+            m.type = NetMsg::CONFIG;
+            m.totalRounds = (uint8_t)room->match.settings.totalRounds;
+            m.maxLives = (uint8_t)room->match.settings.maxLivesSetting;
+            m.timeLimit = (uint16_t)room->match.settings.timeLimitSeconds;
+            m.starterIsP1 = room->match.settings.starterIsP1;
+            m.youAreP1 = (side == 0);
+            m.alphabet = (uint8_t)room->match.settings.alphabet;
+            m.text = room->players[0].name;
+            m.text2 = room->players[1].name;
+            if (!Send(index, side, m)) return;
+        }
+    }
+
+    void StartClock(uint32_t index) {
+        Room* room = rooms.Get(index);
+        uint64_t now = wheel.Now();
+        room->state = RoomState::PLAYING;
+        room->deadline = now + (uint64_t)room->match.settings.timeLimitSeconds * 1000 / TICK_MS;
+        room->expiry = wheel.Schedule(room->deadline, TimerData(index, TIMER_EXPIRY));
+        room->sync = wheel.Schedule(now + SYNC_TICKS, TimerData(index, TIMER_SYNC));
+    }
+
+    void OnTimer(uint64_t data) {
+        uint32_t index = (uint32_t)(data >> 2);
+        Room* room = rooms.Get(index);
+        TimerKind kind = (TimerKind)(data & 3);
+
+        if (kind == TIMER_LINGER) {
+            room->expiry = TimerWheel::NONE;
+            CloseRoom(index);
+            return;
+        }
+        if (kind == TIMER_EXPIRY) {
+            room->expiry = TimerWheel::NONE;
+            room->match.TimeOut();
+            EndRound(index);
+            return;
+        }
+
+        uint64_t left = room->deadline > wheel.Now() ? room->deadline - wheel.Now() : 0;
+        room->match.timeLeft = left * TICK_MS / 1000.0f;
+
+        NetMessage m;
+        m.type = NetMsg::TIMER_SYNC;
+        m.timeCs = (uint32_t)(left * TICK_MS / 10);
+        room->sync = wheel.Schedule(wheel.Now() + SYNC_TICKS, data);
+        SendBoth(index, m);
+    }
+
+    // Scores out, then the next round's setter is awaited (or the room winds down)
+    void EndRound(uint32_t index) {
+        Room* room = rooms.Get(index);
+        wheel.Cancel(room->expiry);
+        wheel.Cancel(room->sync);
+        room->expiry = room->sync = TimerWheel::NONE;
+
+        ServerMatch& match = room->match;
+        NetMessage m;
+        m.type = NetMsg::ROUND_END;
+        m.win = match.win;
+        m.p1Score = (uint8_t)match.player1Score;
+        m.p2Score = (uint8_t)match.player2Score;
+        m.text = match.secretWord;
+
+        if (match.AdvanceRound()) {
+            room->state = RoomState::WAIT_WORD;
+            SendBoth(index, m);
+        } else {
+            // One series per connection. Closing straight away could cut off
+            // the final ROUND_END, so the room waits for the players to leave.
+            seriesPlayed++;
+            room->state = RoomState::FINISHED;
+            room->expiry = wheel.Schedule(wheel.Now() + LINGER_TICKS, TimerData(index, TIMER_LINGER));
+            SendBoth(index, m);
+        }
+    }
+};
+
+// ---------------- Acceptor ----------------
+
+// A waiting player who hung up before being paired
+static bool StillConnected(int fd) {
+    char b;
+    ssize_t n = recv(fd, &b, 1, MSG_PEEK | MSG_DONTWAIT);
+    return n > 0 || (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+static void ParseArgs(int argc, char** argv, ServerConfig& c) {
+    for (int i = 1; i + 1 < argc; ++i) {
+        if (std::strcmp(argv[i], "--port") == 0) c.port = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0) c.threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--rooms") == 0) c.roomsPerWorker = (uint32_t)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--rounds") == 0) c.settings.totalRounds = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--lives") == 0) c.settings.maxLivesSetting = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--time") == 0) c.settings.timeLimitSeconds = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--alphabet") == 0) {
+            const char* name = argv[++i];
+            for (int a = 0; a < (int)AlphabetId::COUNT; ++a) {
+                if (strcasecmp(name, ALPHABET_NAMES[a]) == 0) c.settings.alphabet = (AlphabetId)a;
+            }
+        }
+    }
+    if (c.threads < 1) c.threads = 1;
+    if (c.roomsPerWorker < 1) c.roomsPerWorker = 1;
+    ClampSettings(c.settings);
+}
+
+int main(int argc, char** argv) {
+    ServerConfig config;
+    ParseArgs(argc, argv, config);
+    signal(SIGPIPE, SIG_IGN);
+
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons((uint16_t)config.port);
+    if (bind(listener, (const sockaddr*)&addr, sizeof(addr)) != 0 || listen(listener, 1024) != 0) {
+        std::fprintf(stderr, "cannot listen on port %d\n", config.port);
+        return 1;
+    }
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < config.threads; ++i) {
+        workers.emplace_back(new Worker(config));
+        threads.emplace_back([w = workers.back().get()]() { w->Run(); });
+    }
+    std::printf("hangman_server: port %d, %d workers, %u rooms each\n",
+                config.port, config.threads, config.roomsPerWorker);
+    std::fflush(stdout);
+
+    int waiting = -1;       // first player of the next pair
+    size_t nextWorker = 0;
+    uint64_t lastReport = NowMs();
+
+    for (;;) {
+        pollfd p{ listener, POLLIN, 0 };
+        if (poll(&p, 1, 1000) > 0) {
+            int fd = accept(listener, nullptr, nullptr);
+            if (fd >= 0) {
+                if (waiting >= 0 && !StillConnected(waiting)) {
+                    close(waiting);
+                    waiting = -1;
+                }
+                if (waiting < 0) {
+                    waiting = fd;
+                } else {
+                    workers[nextWorker]->Adopt(waiting, fd);
+                    nextWorker = (nextWorker + 1) % workers.size();
+                    waiting = -1;
+                }
+            } else if (errno == EMFILE || errno == ENFILE) {
+                // Out of descriptors: back off instead of spinning on poll
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        }
+
+        if (NowMs() - lastReport >= 10000) {
+            lastReport = NowMs();
+            uint32_t live = 0;
+            uint64_t done = 0;
+            for (const auto& w : workers) {
+                live += w->liveRooms;
+                done += w->seriesPlayed;
+            }
+            std::printf("rooms: %u live, %llu series finished\n", live, (unsigned long long)done);
+            std::fflush(stdout);
+        }
+    }
+}
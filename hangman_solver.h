@@ -0,0 +1,393 @@
+#pragma once
+// Computer guesser. Candidates are the dictionary words of the secret's
+// length that agree with the revealed pattern and the tried letters; the
+// next guess is the untried letter whose hit/miss answer carries the most
+// information about which candidate it is.
+//
+// State is kept across a round: the surviving rows are an index list into
+// the length bucket that each guess only shrinks, and the per-letter counts
+// lose just the eliminated rows. Later guesses get cheaper as the list
+// shrinks instead of re-scanning the whole bucket.
+//
+// Words are repacked once per length into 32-byte rows (letters, zero
+// padded) so both kernels run one row per SIMD step:
+//   - filtering compares a row against the pattern and looks every hidden
+//     position up in the tried-letter mask with a byte shuffle;
+//   - counting expands each row's letter mask into 32 byte lanes and adds
+//     it to per-letter byte counters.
+// AVX2 (x86, build with -mavx2 or -march=native) and NEON (AArch64) paths,
+// with a scalar fallback that gives the same answers.
+#include "word_dict.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define HANGMAN_SOLVER_AVX2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define HANGMAN_SOLVER_NEON 1
+#endif
+
+static const int PACKED_WIDTH = 32;
+
+struct alignas(PACKED_WIDTH) PackedWord {
+    char c[PACKED_WIDTH];
+};
+
+// All dictionary words of one length, in row form
+struct PackedBucket {
+    int len = 0;
+    std::vector<PackedWord> rows;
+    std::vector<uint32_t> masks;  // letter mask per row
+    uint32_t letterCounts[26] = {}; // rows containing each letter
+};
+
+// Row form of a dictionary, built per length on first use. Building is not
+// thread-safe: call BuildAll() first when several solvers share one.
+class PackedLexicon {
+public:
+    explicit PackedLexicon(const WordDictionary& dict) : dict(dict) {}
+
+    const PackedBucket& Get(int len) {
+        PackedBucket& p = buckets[len];
+        if (!built[len]) {
+            Build(len, p);
+            built[len] = true;
+        }
+        return p;
+    }
+
+    void BuildAll() {
+        for (int len = 1; len <= DICT_MAX_LEN; ++len) Get(len);
+    }
+
+private:
+    const WordDictionary& dict;
+    PackedBucket buckets[DICT_MAX_LEN + 1];
+    bool built[DICT_MAX_LEN + 1] = {};
+
+    void Build(int len, PackedBucket& p) {
+        p.len = len;
+        p.rows.clear();
+        p.masks.clear();
+        if (!dict.IsOpen()) return;
+
+        for (int d = 1; d <= len; ++d) {
+            const DictBucket& b = dict.Bucket(len, d);
+            for (uint32_t i = 0; i < b.count; ++i) {
+                PackedWord w{};
+                std::memcpy(w.c, dict.Word(len, b, i), len);
+                p.rows.push_back(w);
+                p.masks.push_back(dict.Mask(len, b, i));
+            }
+        }
+        for (uint32_t m : p.masks) {
+            for (int l = 0; l < 26; ++l) p.letterCounts[l] += (m >> l) & 1u;
+        }
+    }
+};
+
+// Revealed pattern in row form; '*' in shownWord marks a hidden letter
+struct SolverPattern {
+    alignas(PACKED_WIDTH) unsigned char letters[PACKED_WIDTH] = {}; // revealed chars, 0 elsewhere
+    alignas(PACKED_WIDTH) unsigned char known[PACKED_WIDTH] = {};   // 0xFF = compare, 0 = hidden
+    uint32_t triedMask = 0;
+
+    void Set(std::string_view shown, uint32_t tried) {
+        triedMask = tried;
+        for (int i = 0; i < PACKED_WIDTH; ++i) {
+            bool hidden = i < (int)shown.size() && shown[i] == '*';
+            unsigned char c = (i < (int)shown.size() && !hidden) ? (unsigned char)shown[i] : 0;
+            if (c >= 'a' && c <= 'z') c = (unsigned char)(c - 'a' + 'A'); // typed words keep their case
+            letters[i] = c;
+            known[i] = hidden ? 0x00 : 0xFF;
+        }
+    }
+};
+
+namespace solver_kernels {
+
+// Row agrees with the pattern: same letters where revealed, and no tried
+// letter in a hidden position (a tried letter would have been revealed)
+inline bool MatchScalar(const PackedWord& w, const SolverPattern& p) {
+    for (int i = 0; i < PACKED_WIDTH; ++i) {
+        unsigned char c = (unsigned char)w.c[i];
+        if (p.known[i]) {
+            if (c != p.letters[i]) return false;
+        } else if ((p.triedMask >> (c - 'A')) & 1u) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void CountScalar(const uint32_t* masks, size_t n, uint32_t counts[26]) {
+    for (size_t i = 0; i < n; ++i) {
+        for (uint32_t m = masks[i]; m != 0; m &= m - 1) {
+            int l = 0;
+            while (!((m >> l) & 1u)) l++;
+            counts[l]++;
+        }
+    }
+}
+
+#if defined(HANGMAN_SOLVER_AVX2)
+
+struct MatchAvx2 {
+    __m256i letters, known, triedTable, bitTable, fiveBits, sevenBits, a;
+
+    explicit MatchAvx2(const SolverPattern& p) {
+        letters = _mm256_load_si256((const __m256i*)p.letters);
+        known = _mm256_load_si256((const __m256i*)p.known);
+        // Byte k of the tried mask, looked up by (letter index >> 3)
+        uint32_t t = p.triedMask;
+        triedTable = _mm256_setr_epi8(
+            (char)t, (char)(t >> 8), (char)(t >> 16), (char)(t >> 24), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            (char)t, (char)(t >> 8), (char)(t >> 16), (char)(t >> 24), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+        bitTable = _mm256_setr_epi8(
+            1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0,
+            1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0);
+        fiveBits = _mm256_set1_epi8(0x1F);
+        sevenBits = _mm256_set1_epi8(0x07);
+        a = _mm256_set1_epi8('A');
+    }
+
+    bool operator()(const PackedWord& w) const {
+        __m256i row = _mm256_load_si256((const __m256i*)w.c);
+        __m256i eq = _mm256_cmpeq_epi8(row, letters);
+        __m256i mismatch = _mm256_andnot_si256(eq, known);
+
+        __m256i idx = _mm256_sub_epi8(row, a);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(idx, 3), fiveBits);
+        __m256i lo = _mm256_and_si256(idx, sevenBits);
+        __m256i bit = _mm256_and_si256(_mm256_shuffle_epi8(triedTable, hi),
+                                       _mm256_shuffle_epi8(bitTable, lo));
+        __m256i untried = _mm256_cmpeq_epi8(bit, _mm256_setzero_si256());
+        __m256i ok = _mm256_or_si256(known, untried);
+
+        return _mm256_testz_si256(mismatch, mismatch) &&
+               (uint32_t)_mm256_movemask_epi8(ok) == 0xFFFFFFFFu;
+    }
+};
+
+// Byte lane l counts rows whose mask has bit l; flushed before it can wrap
+inline void CountAvx2(const uint32_t* masks, size_t n, uint32_t counts[26]) {
+    const __m256i spread = _mm256_setr_epi8(
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128,
+        1, 2, 4, 8, 16, 32, 64, (char)128, 1, 2, 4, 8, 16, 32, 64, (char)128);
+
+    size_t i = 0;
+    while (i < n) {
+        size_t end = (n - i > 255) ? i + 255 : n;
+        __m256i acc = _mm256_setzero_si256();
+        for (; i < end; ++i) {
+            __m256i m = _mm256_shuffle_epi8(_mm256_set1_epi32((int)masks[i]), spread);
+            __m256i set = _mm256_cmpeq_epi8(_mm256_and_si256(m, select), select);
+            acc = _mm256_sub_epi8(acc, set);
+        }
+        alignas(32) unsigned char lanes[32];
+        _mm256_store_si256((__m256i*)lanes, acc);
+        for (int l = 0; l < 26; ++l) counts[l] += lanes[l];
+    }
+}
+
+#elif defined(HANGMAN_SOLVER_NEON)
+
+struct MatchNeon {
+    uint8x16_t letters[2], known[2], triedTable, bitTable, a, sevenBits;
+
+    explicit MatchNeon(const SolverPattern& p) {
+        for (int h = 0; h < 2; ++h) {
+            letters[h] = vld1q_u8(p.letters + 16 * h);
+            known[h] = vld1q_u8(p.known + 16 * h);
+        }
+        uint32_t t = p.triedMask;
+        const uint8_t tt[16] = { (uint8_t)t, (uint8_t)(t >> 8), (uint8_t)(t >> 16), (uint8_t)(t >> 24) };
+        const uint8_t bt[16] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+        triedTable = vld1q_u8(tt);
+        bitTable = vld1q_u8(bt);
+        a = vdupq_n_u8('A');
+        sevenBits = vdupq_n_u8(0x07);
+    }
+
+    bool operator()(const PackedWord& w) const {
+        uint8x16_t bad = vdupq_n_u8(0);
+        for (int h = 0; h < 2; ++h) {
+            uint8x16_t row = vld1q_u8((const uint8_t*)w.c + 16 * h);
+            uint8x16_t mismatch = vbicq_u8(known[h], vceqq_u8(row, letters[h]));
+
+            // Out-of-range table indices read as 0, so no masking of hi needed
+            uint8x16_t idx = vsubq_u8(row, a);
+            uint8x16_t bit = vandq_u8(vqtbl1q_u8(triedTable, vshrq_n_u8(idx, 3)),
+                                      vqtbl1q_u8(bitTable, vandq_u8(idx, sevenBits)));
+            uint8x16_t triedHidden = vbicq_u8(vtstq_u8(bit, bit), known[h]);
+            bad = vorrq_u8(bad, vorrq_u8(mismatch, triedHidden));
+        }
+        return vmaxvq_u8(bad) == 0;
+    }
+};
+
+inline void CountNeon(const uint32_t* masks, size_t n, uint32_t counts[26]) {
+    const uint8_t sel[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t select = vld1q_u8(sel);
+
+    size_t i = 0;
+    while (i < n) {
+        size_t end = (n - i > 255) ? i + 255 : n;
+        uint8x16_t acc0 = vdupq_n_u8(0), acc1 = vdupq_n_u8(0);
+        for (; i < end; ++i) {
+            uint32_t m = masks[i];
+            uint8x16_t b01 = vcombine_u8(vdup_n_u8((uint8_t)m), vdup_n_u8((uint8_t)(m >> 8)));
+            uint8x16_t b23 = vcombine_u8(vdup_n_u8((uint8_t)(m >> 16)), vdup_n_u8((uint8_t)(m >> 24)));
+            acc0 = vsubq_u8(acc0, vtstq_u8(b01, select));
+            acc1 = vsubq_u8(acc1, vtstq_u8(b23, select));
+        }
+        uint8_t lanes[32];
+        vst1q_u8(lanes, acc0);
+        vst1q_u8(lanes + 16, acc1);
+        for (int l = 0; l < 26; ++l) counts[l] += lanes[l];
+    }
+}
+
+#endif
+
+} // namespace solver_kernels
+
+// Letters people guess first; used when no dictionary word fits
+static const char SOLVER_FALLBACK_ORDER[] = "ETAOINSHRDLCUMWFGYPBVKJXQZ";
+
+class HangmanSolver {
+public:
+    explicit HangmanSolver(PackedLexicon& lexicon) : lexicon(lexicon) {}
+
+    // Best next letter for this pattern (shownWord) and tried mask,
+    // or 0 when every letter has been tried. Call Reset() when a round
+    // starts; a length change or a tried mask that is not a superset of the
+    // last one is also taken as a new round, as a fallback.
+    char NextGuess(std::string_view shown, uint32_t triedMask) {
+        int len = (int)shown.size();
+        bool fresh = (len != roundLen || (triedMask & lastTried) != lastTried);
+        if (fresh) Reset(len);
+
+        // Spaces in a typed phrase are revealed from the start
+        bool revealed = fresh && shown.find_first_not_of('*') != std::string_view::npos;
+        if (bucket != nullptr && (triedMask != lastTried || revealed)) Narrow(shown, triedMask);
+        lastTried = triedMask;
+        return Choose(triedMask);
+    }
+
+    // New round: the next NextGuess starts from the full bucket (and applies
+    // the revealed spaces)
+    void Reset() { roundLen = -1; }
+
+    size_t Candidates() const { return candidates.size(); }
+
+    // Per-letter number of candidates containing it (after NextGuess)
+    const uint32_t* LetterCounts() const { return counts; }
+
+private:
+    PackedLexicon& lexicon;
+    const PackedBucket* bucket = nullptr;
+    int roundLen = -1;
+    uint32_t lastTried = 0;
+
+    std::vector<uint32_t> candidates;       // surviving row indices, ascending
+    std::vector<uint32_t> eliminatedMasks;  // scratch: masks dropped by the last guess
+    uint32_t counts[26] = {};
+
+    // Every row of this length is a candidate
+    void Reset(int len) {
+        roundLen = len;
+        lastTried = 0;
+        candidates.clear();
+        bucket = nullptr;
+        for (int l = 0; l < 26; ++l) counts[l] = 0;
+        if (len < 1 || len > DICT_MAX_LEN) return;
+
+        bucket = &lexicon.Get(len);
+        candidates.resize(bucket->rows.size());
+        for (uint32_t i = 0; i < (uint32_t)candidates.size(); ++i) candidates[i] = i;
+        for (int l = 0; l < 26; ++l) counts[l] = bucket->letterCounts[l];
+    }
+
+    // Compacts the survivors in place and takes the dropped rows out of the counts
+    void Narrow(std::string_view shown, uint32_t triedMask) {
+        SolverPattern p;
+        p.Set(shown, triedMask);
+
+#if defined(HANGMAN_SOLVER_AVX2)
+        solver_kernels::MatchAvx2 match(p);
+#elif defined(HANGMAN_SOLVER_NEON)
+        solver_kernels::MatchNeon match(p);
+#endif
+        eliminatedMasks.clear();
+        size_t kept = 0;
+        for (size_t k = 0; k < candidates.size(); ++k) {
+            uint32_t i = candidates[k];
+#if defined(HANGMAN_SOLVER_AVX2) || defined(HANGMAN_SOLVER_NEON)
+            bool ok = match(bucket->rows[i]);
+#else
+            bool ok = solver_kernels::MatchScalar(bucket->rows[i], p);
+#endif
+            if (ok) candidates[kept++] = i;
+            else eliminatedMasks.push_back(bucket->masks[i]);
+        }
+        candidates.resize(kept);
+
+        // Whichever side is smaller: subtract the dropped rows or recount the rest
+        if (eliminatedMasks.size() <= kept) {
+            uint32_t dropped[26] = {};
+            Count(eliminatedMasks.data(), eliminatedMasks.size(), dropped);
+            for (int l = 0; l < 26; ++l) counts[l] -= dropped[l];
+        } else {
+            eliminatedMasks.clear();
+            for (uint32_t i : candidates) eliminatedMasks.push_back(bucket->masks[i]);
+            for (int l = 0; l < 26; ++l) counts[l] = 0;
+            Count(eliminatedMasks.data(), eliminatedMasks.size(), counts);
+        }
+    }
+
+    static void Count(const uint32_t* masks, size_t n, uint32_t out[26]) {
+#if defined(HANGMAN_SOLVER_AVX2)
+        solver_kernels::CountAvx2(masks, n, out);
+#elif defined(HANGMAN_SOLVER_NEON)
+        solver_kernels::CountNeon(masks, n, out);
+#else
+        solver_kernels::CountScalar(masks, n, out);
+#endif
+    }
+
+    // A letter every candidate contains costs no life, so it goes first.
+    // Otherwise maximise the entropy of hit/miss, ties to the likelier hit.
+    char Choose(uint32_t triedMask) const {
+        const double n = (double)candidates.size();
+        int best = -1;
+        double bestGain = -1.0;
+
+        for (int l = 0; l < 26 && n > 0; ++l) {
+            if (((triedMask >> l) & 1u) || counts[l] == 0) continue;
+            if (counts[l] == (uint32_t)n) return (char)('A' + l);
+
+            double p = counts[l] / n;
+            double gain = -(p * std::log2(p) + (1.0 - p) * std::log2(1.0 - p));
+            if (gain > bestGain || (gain == bestGain && counts[l] > counts[best])) {
+                best = l;
+                bestGain = gain;
+            }
+        }
+        if (best >= 0) return (char)('A' + best);
+
+        for (const char* c = SOLVER_FALLBACK_ORDER; *c; ++c) {
+            if (!((triedMask >> (*c - 'A')) & 1u)) return *c;
+        }
+        return 0;
+    }
+};
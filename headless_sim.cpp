@@ -0,0 +1,88 @@
+// Headless self-play benchmark: runs the game's rules with no window,
+// audio device or frame cap, and reports throughput. The rule variant is
+// fixed at compile time (classic scoring, 60 s clock, 7 lives): the game's
+// default settings, with the limits as constants.
+//
+// Usage: headless_sim [wordlist.txt] [rounds]
+#include "hangman_rules.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+// Used when no word list is given on the command line
+static const char* kBuiltinWords[] = {
+    "hangman", "raylib", "gallows", "keyboard", "rope", "puzzle", "letter",
+    "window", "summary", "leaderboard", "secret", "hint", "player", "rival",
+    "ice cream", "night owl", "battle", "pressure", "round", "music",
+};
+
+// Guesser script: English letter frequency order
+static const char kGuessOrder[] = "ETAOINSHRDLCUMWFGYPBVKJXQZ";
+
+static vector<string> LoadWords(const char* path) {
+    vector<string> words;
+    std::ifstream in(path);
+    string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (WordValid(line) && Utf8Length(line) <= WORD_MAX_CHARS) words.push_back(line); // same limit as the game
+    }
+    return words;
+}
+
+int main(int argc, char** argv) {
+    vector<string> words;
+    if (argc > 1) {
+        words = LoadWords(argv[1]);
+        if (words.empty()) {
+            std::fprintf(stderr, "No usable words in %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        for (const char* w : kBuiltinWords) words.push_back(w);
+    }
+    long long rounds = (argc > 2) ? std::atoll(argv[2]) : 2000000;
+
+    BasicMatch<ClassicScoring, FixedTimer<60>, FixedLives<7>> match;
+    match.settings.totalRounds = 10;
+    match.StartMatch();
+
+    const float dt = 1.0f / 60.0f; // one simulated frame per guess
+    long long guesses = 0;
+    long long wins = 0;
+    size_t wordIndex = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    for (long long r = 0; r < rounds; ++r) {
+        match.StartRound(words[wordIndex], "sim");
+        if (++wordIndex == words.size()) wordIndex = 0;
+
+        for (const char* g = kGuessOrder; *g && !match.gameOver; ++g) {
+            match.ProcessGuess(*g);
+            match.Tick(dt);
+            guesses++;
+        }
+        if (match.win) wins++;
+
+        if (!match.AdvanceRound()) match.StartMatch();
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    if (secs <= 0.0) secs = 1e-9;
+
+    std::printf("words:       %zu\n", words.size());
+    std::printf("rounds:      %lld (%lld won)\n", rounds, wins);
+    std::printf("guesses:     %lld\n", guesses);
+    std::printf("elapsed:     %.3f s\n", secs);
+    std::printf("rounds/sec:  %.0f\n", rounds / secs);
+    std::printf("ns/guess:    %.1f\n", guesses ? secs * 1e9 / guesses : 0.0);
+    return 0;
+}
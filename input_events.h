@@ -0,0 +1,111 @@
+#pragma once
+// Per-frame input event queue. raylib's key and char queues are drained once
+// per frame and turned into typed events that the active screen consumes.
+// Scripted or replayed input is pushed into the same queue.
+#include "raylib.h"
+#include "alphabet.h"
+
+enum class InputKind : unsigned char {
+    LETTER,     // letter of any alphabet, either case (a guess on the PLAYING screen)
+    TEXT,       // any other typed character
+    NAV_UP,
+    NAV_DOWN,
+    NAV_LEFT,
+    NAV_RIGHT,
+    CONFIRM,    // ENTER
+    CANCEL,     // ESC
+    BACKSPACE,
+    CLICK       // left mouse button pressed at pos
+};
+
+struct InputEvent {
+    InputKind kind = InputKind::TEXT;
+    int codepoint = 0;  // LETTER / TEXT only
+    Vector2 pos{};      // CLICK only
+
+    bool IsChar(int c) const {
+        return (kind == InputKind::LETTER || kind == InputKind::TEXT) && codepoint == c;
+    }
+
+    // Upper-case (folded) letter for LETTER events
+    uint32_t Letter() const { return FoldCase((uint32_t)codepoint); }
+};
+
+class InputQueue {
+public:
+    static const int CAPACITY = 64;
+
+    void Clear() { count = 0; }
+
+    bool Push(const InputEvent& ev) {
+        if (count >= CAPACITY) return false;
+        events[count++] = ev;
+        return true;
+    }
+
+    // Drain raylib's queues into this frame's events, in the order they were
+    // typed. raylib keeps characters and key presses in two queues without
+    // timestamps, but each character comes from a press in the key queue: walk
+    // that in order and take the next character at every key that types one,
+    // so "ab", BACKSPACE, "c" in one slow frame stays in that order. A
+    // character with no press of its own (key repeat, dead-key or IME
+    // composition) still lands after the press before it, not before.
+    void PollRaylib() {
+        Clear();
+
+        int ch = GetCharPressed();
+        for (int key = GetKeyPressed(); key != 0; key = GetKeyPressed()) {
+            if (TypesCharacter(key)) {
+                if (ch > 0) {
+                    PushChar(ch);
+                    ch = GetCharPressed();
+                }
+                continue;
+            }
+            InputEvent ev;
+            bool mapped = true;
+            switch (key) {
+                case KEY_UP:        ev.kind = InputKind::NAV_UP;    break;
+                case KEY_DOWN:      ev.kind = InputKind::NAV_DOWN;  break;
+                case KEY_LEFT:      ev.kind = InputKind::NAV_LEFT;  break;
+                case KEY_RIGHT:     ev.kind = InputKind::NAV_RIGHT; break;
+                case KEY_ENTER:
+                case KEY_KP_ENTER:  ev.kind = InputKind::CONFIRM;   break;
+                case KEY_ESCAPE:    ev.kind = InputKind::CANCEL;    break;
+                case KEY_BACKSPACE: ev.kind = InputKind::BACKSPACE; break;
+                default:            mapped = false;                 break;
+            }
+            if (mapped) Push(ev);
+        }
+        for (; ch > 0; ch = GetCharPressed()) PushChar(ch);
+
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+            InputEvent ev;
+            ev.kind = InputKind::CLICK;
+            ev.pos = GetMousePosition();
+            Push(ev);
+        }
+    }
+
+    const InputEvent* begin() const { return events; }
+    const InputEvent* end() const { return events + count; }
+    int size() const { return count; }
+
+private:
+    InputEvent events[CAPACITY];
+    int count = 0;
+
+    void PushChar(int ch) {
+        InputEvent ev;
+        ev.kind = IsAlphabetLetter((uint32_t)ch) ? InputKind::LETTER : InputKind::TEXT;
+        ev.codepoint = ch;
+        Push(ev);
+    }
+
+    // Keys whose press also queues a character (the printable block, keypad
+    // digits and operators, and the two non-US keys)
+    static bool TypesCharacter(int key) {
+        return (key >= KEY_SPACE && key <= KEY_GRAVE) || key == 161 || key == 162 ||
+               (key >= KEY_KP_0 && key <= KEY_KP_ADD) || key == KEY_KP_EQUAL;
+    }
+};
@@ -0,0 +1,298 @@
+#pragma once
+// Persistent leaderboard: per-player aggregates kept in an append-only log,
+// with a sorted on-disk index so startup only replays the log tail.
+//
+//   leaderboard.log  - one fixed-size LogRecord per finished match score
+//   leaderboard.idx  - aggregates sorted by rank + how much of the log they cover
+//
+// Several kiosks can share the files. The log is only ever appended to, and
+// the in-memory board is the fold of the log prefix read so far: a Record
+// appends, then reads up to the end of the file, picking up other kiosks'
+// records along with its own. The index is checkpointed every
+// CHECKPOINT_RECORDS records, so a crash replays at most that many.
+//
+// In memory, ranks live in an ordered tree: an insert or score update is
+// O(log n). Paging reads a rank-ordered id array, rebuilt in one O(n) walk
+// the first time a page is asked for after a change, so flipping through
+// pages deep into a large board costs O(page) each.
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class LeaderboardStore {
+public:
+    static const int NAME_CAPACITY = 16; // 15-char names (settings limit) + NUL
+
+    struct Entry {
+        char name[NAME_CAPACITY];
+        int64_t totalScore;
+        int32_t games;
+        int32_t bestScore;
+    };
+
+    static const uint32_t CHECKPOINT_RECORDS = 1024; // log records between index rewrites
+
+    explicit LeaderboardStore(std::string basePath = "leaderboard")
+        : logPath(basePath + ".log"), indexPath(basePath + ".idx") {}
+
+    ~LeaderboardStore() { Close(); }
+
+    LeaderboardStore(const LeaderboardStore&) = delete;
+    LeaderboardStore& operator=(const LeaderboardStore&) = delete;
+
+    // Loads the index, replays the log past it, and opens the log for appends
+    bool Open() {
+        Close();
+        // Append mode: every write lands at the current end of the file, so
+        // kiosks sharing it never overwrite each other's records. Unbuffered,
+        // so a batch reaches the file in one write.
+        log = std::fopen(logPath.c_str(), "ab");
+        if (log != nullptr) std::setvbuf(log, nullptr, _IONBF, 0);
+        reader = std::fopen(logPath.c_str(), "rb");
+
+        logBytes = LoadIndex();
+        if (reader != nullptr && std::fseek(reader, 0, SEEK_END) == 0 && (uint64_t)std::ftell(reader) < logBytes) {
+            ClearEntries(); // the log was replaced under the index
+            logBytes = 0;
+        }
+        CatchUp();
+        return log != nullptr;
+    }
+
+    // Rewrites the index so the next Open() skips the replay
+    void Close() {
+        if (log != nullptr) {
+            CatchUp();
+            WriteIndex();
+            std::fclose(log);
+            log = nullptr;
+        }
+        if (reader != nullptr) {
+            std::fclose(reader);
+            reader = nullptr;
+        }
+    }
+
+    // One player's final score from a finished match
+    void Record(std::string_view name, int score) {
+        LogRecord rec = MakeRecord(name, score);
+        Append(&rec, 1);
+    }
+
+    // Several (name, final score) pairs in one append and one flush
+    void RecordBatch(const std::vector<std::pair<std::string_view, int>>& scores) {
+        if (scores.empty()) return;
+        std::vector<LogRecord> recs;
+        recs.reserve(scores.size());
+        for (const auto& s : scores) recs.push_back(MakeRecord(s.first, s.second));
+        Append(recs.data(), recs.size());
+    }
+
+    // Folds records other kiosks appended since this one last wrote
+    void Refresh() { CatchUp(); }
+
+    size_t Size() const { return entries.size(); }
+
+    // Changes whenever the ordering or any aggregate changes
+    uint64_t Version() const { return version; }
+
+    // Ranks [offset, offset + count), best first
+    void Page(size_t offset, size_t count, std::vector<Entry>& out) const {
+        out.clear();
+        if (rankOrderVersion != version) {
+            rankOrder.clear();
+            rankOrder.reserve(ranking.size());
+            for (const auto& r : ranking) rankOrder.push_back(r.second);
+            rankOrderVersion = version;
+        }
+        for (size_t i = offset; i < rankOrder.size() && out.size() < count; ++i) {
+            out.push_back(entries[rankOrder[i]]);
+        }
+    }
+
+private:
+    static const uint32_t LOG_MAGIC   = 0x4C424C47; // "GLBL"
+    static const uint32_t INDEX_MAGIC = 0x58444C47; // "GLDX"
+    static const uint32_t INDEX_VERSION = 1;
+
+    struct LogRecord {
+        uint32_t magic;
+        char name[NAME_CAPACITY];
+        int32_t score;
+    };
+
+    struct IndexHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t logBytes; // log prefix already folded into the entries
+        uint64_t count;
+    };
+
+    // Orders by total score (desc), then by first appearance
+    struct RankKey {
+        bool operator()(const std::pair<int64_t, uint32_t>& a,
+                        const std::pair<int64_t, uint32_t>& b) const {
+            if (a.first != b.first) return a.first > b.first;
+            return a.second < b.second;
+        }
+    };
+
+    std::string logPath;
+    std::string indexPath;
+    FILE* log = nullptr;         // append-only
+    FILE* reader = nullptr;      // same file, read from logBytes on
+    uint64_t logBytes = 0;       // log prefix folded into the entries
+    uint32_t sinceCheckpoint = 0;
+    std::string tmpSuffix;
+    uint64_t version = 0;
+
+    std::vector<Entry> entries;                      // id -> aggregate
+    std::unordered_map<std::string, uint32_t> byName;
+    std::set<std::pair<int64_t, uint32_t>, RankKey> ranking;
+    mutable std::vector<uint32_t> rankOrder;         // ranking's ids, as of rankOrderVersion
+    mutable uint64_t rankOrderVersion = ~0ull;
+
+    static LogRecord MakeRecord(std::string_view name, int score) {
+        LogRecord rec{};
+        rec.magic = LOG_MAGIC;
+        std::memcpy(rec.name, name.data(), std::min(name.size(), (size_t)NAME_CAPACITY - 1));
+        rec.score = score;
+        return rec;
+    }
+
+    // Without a log (Open failed or never called) records only live in memory
+    void Append(const LogRecord* recs, size_t count) {
+        if (log == nullptr || reader == nullptr) {
+            for (size_t i = 0; i < count; ++i) Apply(recs[i].name, recs[i].score);
+            return;
+        }
+        std::fwrite(recs, sizeof(LogRecord), count, log);
+        CatchUp();
+    }
+
+    // Folds every whole record from logBytes to the end of the file. A record
+    // still being written by another kiosk is left for the next call; a torn
+    // one left by a crash is skipped by scanning for the next magic.
+    void CatchUp() {
+        if (reader == nullptr) return;
+        std::clearerr(reader);
+        if (std::fseek(reader, (long)logBytes, SEEK_SET) != 0) return;
+
+        LogRecord rec;
+        while (std::fread(&rec, sizeof(rec), 1, reader) == 1) {
+            if (rec.magic != LOG_MAGIC) {
+                logBytes++;
+                if (std::fseek(reader, (long)logBytes, SEEK_SET) != 0) break;
+                continue;
+            }
+            rec.name[NAME_CAPACITY - 1] = '\0';
+            Apply(rec.name, rec.score);
+            logBytes += sizeof(rec);
+            sinceCheckpoint++;
+        }
+        if (sinceCheckpoint >= CHECKPOINT_RECORDS && log != nullptr) WriteIndex();
+    }
+
+    void ClearEntries() {
+        entries.clear();
+        byName.clear();
+        ranking.clear();
+        version++;
+    }
+
+    void Apply(const char* name, int score) {
+        std::string key(name, strnlen(name, NAME_CAPACITY - 1));
+        auto found = byName.find(key);
+
+        if (found == byName.end()) {
+            uint32_t id = (uint32_t)entries.size();
+            Entry e{};
+            std::strncpy(e.name, key.c_str(), NAME_CAPACITY - 1);
+            e.totalScore = score;
+            e.games = 1;
+            e.bestScore = score;
+            entries.push_back(e);
+            byName.emplace(key, id);
+            ranking.insert({ e.totalScore, id });
+        } else {
+            uint32_t id = found->second;
+            Entry& e = entries[id];
+            ranking.erase({ e.totalScore, id });
+            e.totalScore += score;
+            e.games++;
+            if (score > e.bestScore) e.bestScore = score;
+            ranking.insert({ e.totalScore, id });
+        }
+        version++;
+    }
+
+    // Returns how many log bytes the index already accounts for
+    uint64_t LoadIndex() {
+        ClearEntries();
+
+        FILE* f = std::fopen(indexPath.c_str(), "rb");
+        if (f == nullptr) return 0;
+
+        IndexHeader h{};
+        if (std::fread(&h, sizeof(h), 1, f) != 1 || h.magic != INDEX_MAGIC ||
+            h.version != INDEX_VERSION) {
+            std::fclose(f);
+            return 0;
+        }
+
+        entries.resize((size_t)h.count);
+        if (h.count > 0 &&
+            std::fread(entries.data(), sizeof(Entry), (size_t)h.count, f) != h.count) {
+            entries.clear();
+            std::fclose(f);
+            return 0;
+        }
+        std::fclose(f);
+
+        // Already in rank order, so every insert lands at the end (amortised O(1))
+        for (uint32_t id = 0; id < (uint32_t)entries.size(); ++id) {
+            entries[id].name[NAME_CAPACITY - 1] = '\0';
+            byName.emplace(entries[id].name, id);
+            ranking.insert(ranking.end(), { entries[id].totalScore, id });
+        }
+        return h.logBytes;
+    }
+
+    // Sorted aggregates, written to a temp file and renamed into place. The
+    // temp name is per process, so kiosks checkpointing at once don't collide.
+    void WriteIndex() {
+        sinceCheckpoint = 0;
+        if (tmpSuffix.empty()) tmpSuffix = ".tmp" + std::to_string(std::random_device{}());
+        std::string tmp = indexPath + tmpSuffix;
+        FILE* f = std::fopen(tmp.c_str(), "wb");
+        if (f == nullptr) return;
+
+        IndexHeader h{};
+        h.magic = INDEX_MAGIC;
+        h.version = INDEX_VERSION;
+        h.logBytes = logBytes;
+        h.count = entries.size();
+        bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1;
+
+        for (const auto& r : ranking) {
+            if (!ok) break;
+            ok = std::fwrite(&entries[r.second], sizeof(Entry), 1, f) == 1;
+        }
+        ok = (std::fclose(f) == 0) && ok;
+
+        if (ok) {
+            std::remove(indexPath.c_str());
+            std::rename(tmp.c_str(), indexPath.c_str());
+        } else {
+            std::remove(tmp.c_str());
+        }
+    }
+};
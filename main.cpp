@@ -1,8 +1,32 @@
 #include "raylib.h"
+#include "hangman_rules.h"
+#include "text_layout.h"
+#include "font_manager.h"
+#include "ui_layout.h"
+#include "hangman_mesh.h"
+#include "on_screen_keyboard.h"
+#include "input_events.h"
+#include "frame_pacer.h"
+#include "frame_profiler.h"
+#include "asset_manager.h"
+#include "leaderboard_store.h"
+#include "word_dict.h"
+#include "hangman_solver.h"
+#include "net_session.h"
+#include "game_clock.h"
+#include "replay_log.h"
+#include "audio_engine.h"
+#include "session_snapshot.h"
+#include "telemetry.h"
+#include "tournament.h"
 #include <string>
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstdio>
+#include <chrono>
+#include <cstring>
+#include <random>
 #include <vector>
 
 using std::string;
@@ -19,17 +43,101 @@ enum class GameScreen {
     LEADERBOARD,   // Leaderboard/High Scores Screen
     ENTER_WORD,   // setter enters word + hint
     PLAYING,      // guesser plays
-    SUMMARY       // after all rounds
+    SUMMARY,      // after all rounds
+    TOURNAMENT    // bracket progress, kiosk matches start here
 };
 
-// ---------------- Leaderboard Data Structure ----------------
-struct PlayerScore {
-    string name;
-    int score;
+static const char* const SCREEN_NAMES[] = {
+    "START", "SETTINGS", "SOUND_SETTINGS", "LEADERBOARD", "ENTER_WORD", "PLAYING", "SUMMARY", "TOURNAMENT"
+};
+
+// Who player 1 is up against
+enum class RivalMode {
+    HUMAN,           // two players take turns setting and guessing
+    COMPUTER_SETTER, // words come from words.dict, player 1 always guesses
+    COMPUTER_GUESSER // player 1 sets every word, the solver guesses
+};
+
+enum class WordDifficulty { EASY, MEDIUM, HARD };
+
+// ---------------- Cached Label ----------------
+// Fixed-size text that is only re-formatted when its inputs change, so
+// steady-state frames draw without building temporary strings.
+struct CachedLabel {
+    // Room for the longest label, "HINT: " plus a full HintString
+    static const int CAPACITY = (int)HintString::CAPACITY + 8;
+    char text[CAPACITY] = {};
+    int keys[4] = {};
+    bool valid = false;
+
+    // Returns true (and remembers the new inputs) if the label must be rebuilt
+    bool Changed(int a, int b = 0, int c = 0, int d = 0) {
+        if (valid && keys[0] == a && keys[1] == b && keys[2] == c && keys[3] == d) {
+            return false;
+        }
+        keys[0] = a; keys[1] = b; keys[2] = c; keys[3] = d;
+        valid = true;
+        return true;
+    }
+
+    template <typename... Args>
+    void Format(const char* fmt, Args... args) {
+        std::snprintf(text, CAPACITY, fmt, args...);
+    }
+};
+
+// ---------------- Retained Layer ----------------
+// A render texture holding geometry that only changes when the screen or
+// window size does; blitting it replaces a stack of immediate-mode calls.
+struct RetainedLayer {
+    RenderTexture2D target{};
+    int key = -1;
+    int width = 0, height = 0;
+
+    bool NeedsBake(int newKey, int w, int h) const {
+        return target.id == 0 || key != newKey || width != w || height != h;
+    }
+
+    // Starts drawing into the layer (recreating it if the size changed)
+    void BeginBake(int newKey, int w, int h) {
+        if (target.id == 0 || width != w || height != h) {
+            if (target.id != 0) UnloadRenderTexture(target);
+            target = LoadRenderTexture(w, h);
+        }
+        key = newKey;
+        width = w;
+        height = h;
+        BeginTextureMode(target);
+        ClearBackground(BLANK);
+    }
+
+    void EndBake() {
+        EndTextureMode();
+    }
+
+    // Render textures are stored upside down, hence the negative height
+    void Draw(float x, float y) const {
+        if (target.id == 0) return;
+        Rectangle src = { 0, 0, (float)width, -(float)height };
+        DrawTextureRec(target.texture, src, Vector2{ x, y }, WHITE);
+    }
+
+    // Full-screen layers: baked pixels already hold the final colour (their
+    // alpha is left over from blending), so copy them as-is over a cleared frame
+    void DrawOpaque() const {
+        ClearBackground(BLACK);
+        BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+        Draw(0, 0);
+        EndBlendMode();
+    }
+
+    // Forces a re-bake on next use (e.g. an input texture arrived)
+    void Invalidate() { key = -1; }
 
-    // Helper for sorting
-    bool operator>(const PlayerScore& other) const {
-        return score > other.score;
+    void Unload() {
+        if (target.id != 0) UnloadRenderTexture(target);
+        target = RenderTexture2D{};
+        key = -1;
     }
 };
 
@@ -42,71 +150,82 @@ public:
         // Default settings
         player1Name = "Player 1";
         player2Name = "Player 2";
-        starterIsP1 = true;
-        totalRounds = 3;
-        maxLivesSetting = 7;      // max wrong guesses (1–7)
-        timeLimitSeconds = 60;    // default 60s per word
 
         // Sound settings
         soundEnabled = true;
         musicEnabled = false; 
 
-        currentRound = 1;
-
-        // Scores
-        player1Score = 0;
-        player2Score = 0;
-
         // Start game in START screen
         currentScreen = GameScreen::START;
+        profiler.SetScreenNames(SCREEN_NAMES, (int)(sizeof(SCREEN_NAMES) / sizeof(SCREEN_NAMES[0])));
 
         // Other state init
-        player1IsSetter = true;
         ResetRoundState();
         ResetWordInput();
         ResetSettingsInput();
         soundSettingsFieldIndex = 0;
         
-        // --- Use built-in font but make it smoother ---
-        uiFont = GetFontDefault();
+        // Built-in font until ui_font.ttf has been baked (see PollAssets)
+        fonts.InitDefault();
+        textCache.SetFont(fonts.GetFont());
 
-        // Load visual asset
-        startBg = LoadTexture("start_bg.jpg");
-        
-        // NEW: Load and Set Window Icon
-        // NOTE: The file 'icon.png' must exist in your project root.
-        windowIcon = LoadImage("hangman_img.png");
-        if (windowIcon.data != NULL) {
-            TraceLog(LOG_INFO, "ICON: Image loaded successfully. Setting window icon.");
-            SetWindowIcon(windowIcon);
-        } else {
-            TraceLog(LOG_ERROR, "ICON: FAILED to load icon.png! Check filename and format.");
+        // On-screen keyboard sits under the word in the main play area
+        UiBox kb = layout.Box(UiRect::KEYBOARD);
+        keyboard.SetOrigin(kb.x, kb.y);
+
+        // Mapped, not parsed: opening costs the same for any dictionary size
+        if (dictionary.Open("words.dict")) {
+            TraceLog(LOG_INFO, "DICT: words.dict, %u words", dictionary.WordCount());
         }
+        std::random_device entropy;
+        wordSeed = ((uint64_t)entropy() << 32) | entropy();
+        wordRng.seed(wordSeed);
 
-        // Load audio assets
-        if (IsAudioDeviceReady()) {
-            clickSound = LoadSound("click.wav");
-            // NOTE: Replace "music.ogg" with your actual music file name.
-            backgroundMusic = LoadMusicStream("music.ogg"); 
-            
-            if (backgroundMusic.frameCount > 0) {
-                PlayMusicStream(backgroundMusic);
-            }
-        } 
+        if (!leaderboard.Open()) {
+            TraceLog(LOG_WARNING, "LEADERBOARD: cannot open leaderboard.log, scores won't be saved");
+        }
+
+        // Images and audio are decoded in the background; the START screen
+        // shows a plain placeholder until they arrive (see PollAssets)
+        assets.Start();
     }
 
     ~HangmanGame() {
+        TraceLog(LOG_INFO, "TEXT: layout cache %llu hits, %llu misses",
+                 textCache.hits, textCache.misses);
+
         if (startBg.id != 0) {
             UnloadTexture(startBg);
         }
-        if (clickSound.frameCount > 0) {
-            UnloadSound(clickSound);
+
+        AudioStats as = audio.Stats();
+        TraceLog(LOG_INFO, "AUDIO: decode %.1f ms, device callback %.1f ms, %llu frames, %llu underruns",
+                 as.decodeMs, as.deviceMs, (unsigned long long)as.decodedFrames,
+                 (unsigned long long)as.underruns);
+        audio.Shutdown();
+
+        if (tournament.Active()) {
+            // Matches in flight finish first; their scores still count
+            tournament.Shutdown();
+            PollTournament();
         }
-        
-        if (backgroundMusic.frameCount > 0) {
-            UnloadMusicStream(backgroundMusic);
+
+        if (telemetry.Active()) {
+            telemetry.Shutdown();
+            TraceLog(LOG_INFO, "TELEMETRY: %llu events, %llu dropped",
+                     (unsigned long long)telemetry.Recorded(), (unsigned long long)telemetry.Dropped());
+        }
+
+        if (snapshotting) {
+            snapshots.Submit(CaptureSnapshot());
+            snapshots.Shutdown();
+            TraceLog(LOG_INFO, "SNAPSHOT: %llu writes, %llu failed",
+                     (unsigned long long)snapshots.Writes(), (unsigned long long)snapshots.Failures());
         }
         
+        screenLayer.Unload();
+        keyboard.Unload();
+
         // NEW: Unload Window Icon
         if (windowIcon.data != NULL) {
             UnloadImage(windowIcon);
@@ -115,10 +234,41 @@ public:
 
     // Called each frame
     void Update() {
-        if (backgroundMusic.frameCount > 0) {
-            UpdateMusicStream(backgroundMusic);
-            SetMusicVolume(backgroundMusic, musicEnabled ? 0.5f : 0.0f);
+        profiler.BeginFrame(GetFrameTime(), (int)currentScreen);
+        ProfileScope updateTiming(profiler, ProfileSection::UPDATE);
+
+        // Debug keys: raylib's key state, so they work during a replay too
+        if (IsKeyPressed(KEY_F3)) profiler.overlayVisible = !profiler.overlayVisible;
+        if (IsKeyPressed(KEY_F4)) {
+            if (profiler.ExportCsv("frame_profile.csv")) TraceLog(LOG_INFO, "PROFILE: wrote frame_profile.csv");
+            else TraceLog(LOG_WARNING, "PROFILE: cannot write frame_profile.csv");
+        }
+
+        // Window resized: new canvas fit (drawing and mouse mapping)
+        view.Fit(GetScreenWidth(), GetScreenHeight());
+
+        if (assets.Busy()) PollAssets();
+
+        // The clock and this frame's input come from the devices, or from a replay
+        if (replay.IsOpen()) {
+            ReplayNextFrame();
+        } else {
+            clock.Advance(GetFrameTime());
+            // One drain of raylib's input queues per frame, dispatched to the active screen
+            if (pollInput) input.PollRaylib();
         }
+        if (recorder.IsOpen()) RecordFrame();
+
+        {
+            // Decoding and mixing run on their own threads; this only acts on a toggle
+            ProfileScope audioTiming(profiler, ProfileSection::AUDIO);
+            audio.SetMusicPlaying(musicEnabled);
+            if (profiler.overlayVisible) UpdateAudioStatus();
+        }
+
+        // Socket is drained before the screens look at their messages
+        if (net.Active()) PumpNetwork();
+        if (tournament.Active()) PollTournament();
         
         switch (currentScreen) {
             case GameScreen::START:      UpdateStart();      break;
@@ -128,34 +278,241 @@ public:
             case GameScreen::ENTER_WORD: UpdateEnterWord();  break;
             case GameScreen::PLAYING:    UpdatePlaying();    break;
             case GameScreen::SUMMARY:    UpdateSummary();    break;
+            case GameScreen::TOURNAMENT: UpdateTournament(); break;
         }
+
+        if (replayExpectSettings) ReplayDiverged("the series was not started");
+
+        if (snapshotting) TrackSnapshot();
+        if (telemetry.Active()) TrackTelemetry();
+
+        // Scripted events are consumed by exactly one Update()
+        if (!pollInput) input.Clear();
     }
 
+    // How often frames are needed right now (see FramePacer)
+    PaceMode RequiredPace() const {
+        // The socket is only read between frames, so frame rate is latency
+        if (net.Connected()) return PaceMode::ACTIVE;
+
+        if (currentScreen == GameScreen::PLAYING) {
+            bool animating = wrongShakeTimer > 0.0f || winJumpTimer > 0.0f;
+            if (!match.gameOver || animating) return PaceMode::ACTIVE; // timer + animations
+        }
+
+        // Live bracket: computer matches finish without any input
+        if (currentScreen == GameScreen::TOURNAMENT && bracketView.champion < 0) return PaceMode::LOW;
+
+        bool blinkingCursor = (currentScreen == GameScreen::SETTINGS) &&
+                              (settingsFieldIndex == 0 || settingsFieldIndex == 1);
+        if (blinkingCursor || net.Active()) return PaceMode::LOW;
+
+        return PaceMode::IDLE;
+    }
+
+    // --scoring from the command line (the rules variant for every series)
+    void SetRules(const RuleOptions& opts) {
+        match.settings.scoring = opts.scoring;
+    }
+
+    // Settings (and a hot-seat match left unfinished) from the last session,
+    // then keeps session.snap current. Not for replays or recordings: those
+    // must start from the defaults.
+    void RestoreSnapshot(bool resumeMatch) {
+        auto begin = std::chrono::steady_clock::now();
+        snapshotting = true;
+        snapshots.Start(SNAPSHOT_FILE);
+
+        SessionSnapshot s;
+        if (!LoadSnapshot(SNAPSHOT_FILE, s)) return;
+        s.player1[sizeof(s.player1) - 1] = '\0';
+        s.player2[sizeof(s.player2) - 1] = '\0';
+        s.secretWord[sizeof(s.secretWord) - 1] = '\0';
+        s.hint[sizeof(s.hint) - 1] = '\0';
+
+        player1Name = s.player1;
+        player2Name = s.player2;
+        namesVersion++;
+
+        MatchSettings& ms = match.settings;
+        ms.totalRounds = s.totalRounds;
+        ms.maxLivesSetting = s.maxLives;
+        ms.timeLimitSeconds = s.timeLimit;
+        ms.starterIsP1 = (s.flags & SNAP_STARTER_P1) != 0;
+        ms.swapRoles = (s.flags & SNAP_SWAP_ROLES) != 0;
+        ms.alphabet = s.alphabet < (uint8_t)AlphabetId::COUNT ? (AlphabetId)s.alphabet : AlphabetId::ENGLISH;
+        ClampSettings(ms);
+        soundEnabled = (s.flags & SNAP_SOUND) != 0;
+        musicEnabled = (s.flags & SNAP_MUSIC) != 0;
+        rival = s.rival <= (uint8_t)RivalMode::COMPUTER_GUESSER ? (RivalMode)s.rival : RivalMode::HUMAN;
+        difficulty = s.difficulty <= (uint8_t)WordDifficulty::HARD ? (WordDifficulty)s.difficulty
+                                                                  : WordDifficulty::MEDIUM;
+        ResetSettingsInput();
+
+        if (resumeMatch && (s.flags & SNAP_IN_MATCH)) {
+            // A series keeps the rules it started with, whatever --scoring says now
+            if (s.scoring < (uint8_t)ScoringRule::COUNT) ms.scoring = (ScoringRule)s.scoring;
+
+            ApplyRivalOverrides();
+            match.StartMatch();
+            ResetRoundState();
+            ResetWordInput();
+            match.currentRound = std::clamp((int)s.currentRound, 1, ms.totalRounds);
+            match.player1IsSetter = (s.flags & SNAP_P1_IS_SETTER) != 0;
+            match.player1Score = s.player1Score;
+            match.player2Score = s.player2Score;
+
+            if (s.screen == (uint8_t)GameScreen::PLAYING && s.secretWord[0] != '\0') {
+                match.RestoreRound(s.secretWord, s.hint, s.triedMask, s.lives, s.timeLeft,
+                                   (s.flags & SNAP_ROUND_OVER) != 0, (s.flags & SNAP_ROUND_WON) != 0);
+                currentScreen = GameScreen::PLAYING;
+            } else {
+                currentScreen = GameScreen::ENTER_WORD;
+            }
+        }
+        snapScreen = currentScreen; // no rewrite of what was just read
+
+        double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - begin).count();
+        TraceLog(LOG_INFO, "SNAPSHOT: restored %s in %.1f us",
+                 currentScreen == GameScreen::START ? "settings" : "settings and match", us);
+    }
+
+    // --telemetry <file>: NDJSON event log (see telemetry.h)
+    void StartTelemetry(const TelemetryOptions& opts) {
+        if (opts.path == nullptr) return;
+        if (telemetry.Start(opts.path)) TraceLog(LOG_INFO, "TELEMETRY: writing %s", opts.path);
+        else TraceLog(LOG_WARNING, "TELEMETRY: cannot open %s", opts.path);
+        telemetrySerial = match.roundSerial;
+        telemetryOver = match.gameOver;
+    }
+
+    // --tournament / --kiosk from the command line (see tournament.h)
+    void StartTournament(const TournamentOptions& opts) {
+        // Computer players and kiosk games against them need words
+        if (!dictionary.IsOpen()) {
+            TraceLog(LOG_WARNING, "TOURNAMENT: needs words.dict (build it with dict_builder)");
+            return;
+        }
+        tournament.Start(opts, match.settings, dictionary, wordSeed);
+        currentScreen = GameScreen::TOURNAMENT;
+    }
+
+    // --host / --join from the command line; hot-seat when neither is given
+    void StartNetwork(const NetOptions& opts) {
+        if (!opts.name.empty()) {
+            p1NameInput = opts.name; // cut to NAME_MAX_CHARS
+            localName = p1NameInput;
+        }
+        if (opts.hostPort > 0) {
+            if (net.Host((uint16_t)opts.hostPort)) {
+                netStatus = "Waiting for player 2 on port " + std::to_string(opts.hostPort) + "...";
+            } else {
+                netStatus = "Cannot listen on port " + std::to_string(opts.hostPort);
+            }
+        } else if (opts.joinPort > 0) {
+            if (net.Join(opts.joinHost.c_str(), (uint16_t)opts.joinPort)) {
+                netStatus = "Connecting to " + opts.joinHost + "...";
+            } else {
+                netStatus = "Cannot resolve " + opts.joinHost;
+            }
+        }
+    }
+
+    // Feed input from a script/replay instead of the devices
+    void PushScriptedInput(const InputEvent& ev) {
+        pollInput = false;
+        input.Push(ev);
+    }
+
+    // --record: every frame from now on goes to the log
+    bool StartRecording(const char* path) {
+        if (!recorder.Open(path, wordSeed, dictionary.WordCount())) {
+            TraceLog(LOG_WARNING, "REPLAY: cannot write %s", path);
+            return false;
+        }
+        TraceLog(LOG_INFO, "REPLAY: recording to %s", path);
+        return true;
+    }
+
+    // --replay: frames come from the log until it runs out, then input is live again
+    bool StartReplay(const char* path) {
+        if (!replay.Open(path)) {
+            TraceLog(LOG_WARNING, "REPLAY: %s is not a replay log", path);
+            return false;
+        }
+        if (replay.Header().dictWords != dictionary.WordCount()) {
+            TraceLog(LOG_WARNING, "REPLAY: recorded with a %u-word dictionary, words.dict has %u",
+                     replay.Header().dictWords, dictionary.WordCount());
+        }
+        wordSeed = replay.Header().seed;
+        wordRng.seed(wordSeed);
+        replayed = true;
+        return true;
+    }
+
+    bool Replaying() const { return replay.IsOpen(); }
+    int ReplayDivergences() const { return replayDivergences; }
+    const GameClock& Clock() const { return clock; }
+
     // Called each frame to draw
     void Draw() {
-        switch (currentScreen) {
-            case GameScreen::START:      DrawStart();      break;
-            case GameScreen::SETTINGS:   DrawSettings();   break;
-            case GameScreen::SOUND_SETTINGS: DrawSoundSettings(); break;
-            case GameScreen::LEADERBOARD: DrawLeaderboard(); break;
-            case GameScreen::ENTER_WORD: DrawEnterWord();  break;
-            case GameScreen::PLAYING:    DrawPlaying();    break;
-            case GameScreen::SUMMARY:    DrawSummary();    break;
+        {
+            ProfileScope drawTiming(profiler, ProfileSection::DRAW);
+            profiler.SetDrawScreen((int)currentScreen);
+
+            // Static chrome for this screen (background, card, sidebar) in one blit
+            PrepareLayers();
+            screenLayer.DrawOpaque();
+            profiler.CountDraws(1);
+
+            // Screens draw on the virtual canvas; the view fits it to the window
+            BeginMode2D(view.Camera());
+            switch (currentScreen) {
+                case GameScreen::START:      DrawStart();      break;
+                case GameScreen::SETTINGS:   DrawSettings();   break;
+                case GameScreen::SOUND_SETTINGS: DrawSoundSettings(); break;
+                case GameScreen::LEADERBOARD: DrawLeaderboard(); break;
+                case GameScreen::ENTER_WORD: DrawEnterWord();  break;
+                case GameScreen::PLAYING:    DrawPlaying();    break;
+                case GameScreen::SUMMARY:    DrawSummary();    break;
+                case GameScreen::TOURNAMENT: DrawTournament(); break;
+            }
+
+            // All of the screen's text, over its shapes, in one pass
+            if (fonts.Pending()) {
+                ProfileScope textTiming(profiler, ProfileSection::TEXT);
+                fonts.Flush();
+                profiler.CountDraws(1);
+            }
+            EndMode2D();
         }
+
+        if (profiler.overlayVisible) profiler.DrawOverlay(GetScreenWidth());
     }
 
 private:
     // ---------------- Window / global state ----------------
     int screenWidth, screenHeight;
     GameScreen currentScreen;
-    Font uiFont; // built-in font, smoothed
+    UiLayout layout;   // every screen's rectangles on the virtual canvas
+    UiView view;       // canvas -> window fit (scale + letterbox)
+    FontManager fonts; // SDF UI font (or the built-in one) + this frame's text queue
+    InputQueue input;       // this frame's input events
+    bool pollInput = true;  // false while input is scripted
+    GameClock clock;        // drives every timer and animation
+    FrameProfiler profiler; // F3 overlay / F4 CSV
+
+    // Session recording / replay (see replay_log.h)
+    ReplayRecorder recorder;
+    ReplayReader replay;
+    ReplayFrame replayFrame;
+    bool replayed = false;              // a replayed session never touches the leaderboard
+    bool replayExpectSettings = false;  // this frame's log says a series starts
+    int replayDivergences = 0;
+    TextLayoutCache textCache; // measured sizes of drawn labels
 
     // ---------------- Settings (user-configurable) ----------------
-    string player1Name, player2Name;
-    bool starterIsP1;
-    int totalRounds;
-    int maxLivesSetting;
-    int timeLimitSeconds;
+    NameString player1Name, player2Name;
     
     // Sound settings
     bool soundEnabled;
@@ -163,121 +520,239 @@ private:
 
     // For settings input
     int settingsFieldIndex;
-    string p1NameInput, p2NameInput;
+    NameString p1NameInput, p2NameInput;
     string settingsMessage;
+    static const int SETTINGS_FIELD_COUNT = 8;
+    RivalMode rival = RivalMode::HUMAN;
+    WordDifficulty difficulty = WordDifficulty::MEDIUM;
+
+    // Computer setter / guesser
+    WordDictionary dictionary;
+    uint64_t wordSeed = 0;   // recorded, so computer-set words replay too
+    std::mt19937_64 wordRng;
+    PackedLexicon lexicon{ dictionary };
+    HangmanSolver solver{ lexicon };
+    static constexpr float AI_GUESS_DELAY = 0.7f; // seconds between computer guesses
+    float aiGuessTimer = 0.0f;
     
     // For sound settings input (0=sound, 1=music)
     int soundSettingsFieldIndex; 
 
+    // ---------------- Network (two machines) ----------------
+    // The host runs the rules and is player 1; the joining machine is
+    // player 2 and mirrors the round from the host's messages.
+    NetSession net;
+    string netStatus;          // connection state shown on START / SETTINGS
+    NameString localName;      // --name, sent to the host when joining
+    NameString remoteName;     // joiner's name as received by the host
+    bool localIsP1 = true;     // joiner learns its side from CONFIG
+    bool wordSent = false;     // joiner set the word and awaits ROUND_START
+    int lastSyncSecond = -1;   // host: last TIMER_SYNC sent
+    CachedLabel pingLabel;
+
     // ---------------- Game State ----------------
-    bool player1IsSetter;
-    int currentRound;
-    int player1Score;
-    int player2Score;
+    HangmanMatch match; // rules, round/series state and rule settings
+
+    // Session snapshot (see session_snapshot.h); what was last handed to the writer
+    SnapshotWriter snapshots;
+    bool snapshotting = false;
+    GameScreen snapScreen = GameScreen::START;
+    uint64_t snapTried = 0;
+    int snapSerial = 0;
+    bool snapOver = false;
+
+    // Telemetry (see telemetry.h); the round it last saw, for round starts / ends
+    TelemetrySink telemetry;
+    int telemetrySerial = 0;
+    bool telemetryOver = false;
+    double lastGuessAt = 0.0;  // game clock at the round start or the previous guess
+
+    // Tournament (see tournament.h); the game thread only ever try-locks it
+    TournamentRunner tournament;
+    TournamentView bracketView;          // last copy, redrawn until a newer one is taken
+    vector<string> bracketLabels;        // two per match, rebuilt with the copy
+    string bracketStatus;
+    vector<TournamentScore> bracketScores;
+    bool championLogged = false;
+
+    // The kiosk series being played (match -1 when none), and what it replaced
+    KioskMatch kiosk;
+    bool kioskAIsP1 = true;
+    NameString kioskSavedP1, kioskSavedP2;
+    RivalMode kioskSavedRival = RivalMode::HUMAN;
     
     // Leaderboard
-    vector<PlayerScore> leaderboard; // Stores top scores
+    LeaderboardStore leaderboard;                 // persistent per-player totals
+    static const int LEADERBOARD_PAGE_SIZE = 5;
+    int leaderboardPage = 0;
+    vector<LeaderboardStore::Entry> leaderboardRows; // current page, refreshed on change
+    uint64_t leaderboardRowsVersion = 0;
+    int leaderboardRowsPage = -1;
     
-    // For word entry
-    string inputWord;
-    string inputHint;
+    // For word entry (inline buffers, like the match state)
+    WordString inputWord;
+    HintString inputHint;
     int inputStep;
     string inputErrorMsg;
 
-    // For guessing phase
-    string secretWord;
-    string hint;
-    string shownWord;
-    string triedLetters;
-    int lives;
-    bool gameOver;
-    bool win;
-    float timeLeft;
+    int namesVersion = 0; // bumped whenever player names are applied
+
+    // Settings a vs-computer series overrides (see ApplyRivalOverrides)
+    struct UserSettings {
+        bool saved = false;
+        bool starterIsP1 = true;
+        bool swapRoles = true;
+        AlphabetId alphabet = AlphabetId::ENGLISH;
+    } userSettings;
+
+    // Labels for PLAYING / SUMMARY, rebuilt only when their inputs change
+    CachedLabel puzzleHeaderLabel, titleLabel, wordLabel;
+    CachedLabel scoreLabels[2];
+    CachedLabel livesLabel, timeLabel, resultLabel, wordWasLabel;
+    CachedLabel roundsLabel, p1SummaryLabel, p2SummaryLabel, winnerLabel;
+    CachedLabel leaderboardPageLabel;
+
     // Animation state (purely visual — does NOT affect logic)
     float wrongShakeTimer = 0.0f;  
     float winJumpTimer    = 0.0f;  
 
     // ---------------- Assets ----------------
     Texture2D startBg{};    // background image for start page
-    Sound clickSound{};     // Button click sound
-    Music backgroundMusic{};// Background Music Stream
     Image windowIcon{};     // NEW: Window Icon Image
+    AudioEngine audio;      // click voices + background music stream
+
+    AssetManager assets;                // background loader for the above
+    vector<LoadedAsset> loadedAssets;   // reused each PollAssets()
+
+    // ---------------- Retained layers ----------------
+    RetainedLayer screenLayer;  // current screen's static background/card chrome
+    HangmanMesh hangmanMesh;    // gallows + body, every stage precomputed
+    OnScreenKeyboard keyboard;  // letter grid on the PLAYING screen
 
     // ---------------- Helper methods ----------------
     
-    void PlayClick() {
-        if (soundEnabled && clickSound.frameCount > 0) {
-            PlaySound(clickSound);
+    // Upload whatever the loader finished since last frame (main thread only)
+    void PollAssets() {
+        assets.Poll(loadedAssets);
+
+        for (LoadedAsset& a : loadedAssets) {
+            if (telemetry.Active()) {
+                TelemetryEvent e = MakeEvent(TelemetryKind::ASSET_LOAD);
+                e.label = ASSET_NAMES[(int)a.id];
+                e.value[0] = (float)a.loadMs;
+                telemetry.Record(e);
+            }
+            switch (a.id) {
+                case AssetId::START_BG:
+                    if (a.image.data != NULL) {
+                        startBg = LoadTextureFromImage(a.image);
+                        screenLayer.Invalidate(); // swap the placeholder for the image
+                    }
+                    break;
+
+                case AssetId::WINDOW_ICON:
+                    // NEW: Load and Set Window Icon
+                    if (a.image.data != NULL) {
+                        TraceLog(LOG_INFO, "ICON: Image loaded successfully. Setting window icon.");
+                        windowIcon = a.image;
+                        a.image = Image{}; // kept until shutdown
+                        SetWindowIcon(windowIcon);
+                    } else {
+                        TraceLog(LOG_ERROR, "ICON: FAILED to load hangman_img.png! Check filename and format.");
+                    }
+                    break;
+
+                case AssetId::CLICK_SOUND:
+                    if (IsAudioDeviceReady() && a.wave.data != NULL) {
+                        audio.LoadUiSound(a.wave);
+                    }
+                    break;
+
+                case AssetId::MUSIC:
+                    if (IsAudioDeviceReady() && a.data != nullptr) {
+                        // The decoder reads these bytes while playing; the
+                        // asset pack owns them when borrowed
+                        audio.OpenMusic(a.data, a.dataSize, !a.borrowed);
+                        a.data = nullptr;
+                    }
+                    break;
+
+                case AssetId::UI_FONT:
+                    if (a.font.glyphs != nullptr) {
+                        fonts.Adopt(a.font, a.image);
+                        a.font = Font{};
+                        a.image = Image{};
+                        // Layouts and key labels were measured with the old font
+                        textCache.SetFont(fonts.GetFont());
+                        keyboard.Unload();
+                    }
+                    break;
+            }
+
+            TraceLog(LOG_INFO, "ASSETS: item %d decoded in %.1f ms", (int)a.id, a.loadMs);
+            AssetManager::Release(a);
         }
     }
 
+    void PlayClick() {
+        if (soundEnabled) audio.PlayUi();
+    }
+
+    // Audio thread totals for the F3 overlay
+    void UpdateAudioStatus() {
+        AudioStats as = audio.Stats();
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "audio thr ms  decode %.1f  device %.1f  underruns %llu",
+                      as.decodeMs, as.deviceMs, (unsigned long long)as.underruns);
+        profiler.SetStatus(buf);
+    }
+
     void UpdateLeaderboardScores() {
-        // 1. Add current players' final scores
-        if (player1Score > 0) leaderboard.push_back({player1Name, player1Score});
-        if (player2Score > 0) leaderboard.push_back({player2Name, player2Score});
+        if (replayed) return;
 
-        // 2. Sort the list descending by score
-        std::sort(leaderboard.begin(), leaderboard.end(), 
-                  [](const PlayerScore& a, const PlayerScore& b) {
-                      return a.score > b.score;
-                  });
+        // Kiosk series are recorded with the rest of the bracket's results
+        if (kiosk.match >= 0) return;
 
-        // 3. Keep only the top 3 scores
-        if (leaderboard.size() > 3) {
-            leaderboard.resize(3);
-        }
+        // The host records both players of a networked match
+        if (net.Active() && !net.IsHost()) return;
+
+        // Add current players' final scores to their running totals
+        if (match.player1Score > 0) leaderboard.Record(player1Name, match.player1Score);
+        if (match.player2Score > 0 && rival == RivalMode::HUMAN) leaderboard.Record(player2Name, match.player2Score);
+    }
+
+    int LeaderboardPageCount() const {
+        int n = (int)leaderboard.Size();
+        return n == 0 ? 1 : (n + LEADERBOARD_PAGE_SIZE - 1) / LEADERBOARD_PAGE_SIZE;
     }
 
 
     void DrawTextSmooth(const string& txt, int x, int y, int fontSize,
                         Color color, float spacing = 1.0f) {
-        DrawTextEx(uiFont, txt.c_str(),
-                   Vector2{ (float)x, (float)y },
-                   (float)fontSize, spacing, color);
+        ProfileScope textTiming(profiler, ProfileSection::TEXT);
+        fonts.Queue(txt.c_str(), Vector2{ (float)x, (float)y }, (float)fontSize, spacing, color);
     }
 
     void DrawTextSmooth(const char* txt, int x, int y, int fontSize,
                         Color color, float spacing = 1.0f) {
-        DrawTextEx(uiFont, txt,
-                   Vector2{ (float)x, (float)y },
-                   (float)fontSize, spacing, color);
+        ProfileScope textTiming(profiler, ProfileSection::TEXT);
+        fonts.Queue(txt, Vector2{ (float)x, (float)y }, (float)fontSize, spacing, color);
     }
     void DrawTextCentered(const string& txt, int centerX, int y, int fontSize, Color color, float spacing = 1.0f) {
-        Vector2 size = MeasureTextEx(uiFont, txt.c_str(), (float)fontSize, spacing);
+        ProfileScope textTiming(profiler, ProfileSection::TEXT);
+        Vector2 size = textCache.Measure(txt.c_str(), (float)fontSize, spacing);
         float x = centerX - size.x / 2.0f;
-        DrawTextEx(uiFont, txt.c_str(),
-                   Vector2{ x, (float)y },
-                   (float)fontSize, spacing, color);
-    }
-
-    // Pretty print word as "A _ _" style (visual only)
-    string SpacedWord(const string& s) {
-        string out;
-        for (char c : s) {
-            if (c == '*') {
-                out.push_back('_');
-            } else if (c == ' ') {
-                out.push_back(' ');
-            } else {
-                out.push_back(c);
-            }
-            out.push_back(' ');
-        }
-        return out;
+        fonts.Queue(txt.c_str(), Vector2{ x, (float)y }, (float)fontSize, spacing, color);
     }
 
     void ResetRoundState() {
-        secretWord.clear();
-        hint.clear();
-        shownWord.clear();
-        triedLetters.clear();
-        lives = 0;
-        gameOver = false;
-        win = false;
-        timeLeft = (float)timeLimitSeconds;
+        match.ResetRound();
 
         wrongShakeTimer = 0.0f;
         winJumpTimer = 0.0f;
+        aiGuessTimer = AI_GUESS_DELAY;
+        lastSyncSecond = -1;
+        if (rival == RivalMode::COMPUTER_GUESSER) solver.Reset();
     }
 
     void ResetWordInput() {
@@ -285,6 +760,7 @@ private:
         inputHint.clear();
         inputStep = 0;
         inputErrorMsg.clear();
+        wordSent = false;
     }
 
     void ResetSettingsInput() {
@@ -304,124 +780,508 @@ private:
 
         int fontSize = 22;
         float spacing = 2.0f;
-        Vector2 ts = MeasureTextEx(uiFont, label, (float)fontSize, spacing);
+        Vector2 ts = textCache.Measure(label, (float)fontSize, spacing);
         float tx = r.x + (r.width  - ts.x) / 2.0f;
         float ty = r.y + (r.height - ts.y) / 2.0f;
 
-        DrawTextEx(uiFont, label, Vector2{tx, ty}, (float)fontSize, spacing, RAYWHITE);
+        ProfileScope textTiming(profiler, ProfileSection::TEXT);
+        fonts.Queue(label, Vector2{tx, ty}, (float)fontSize, spacing, RAYWHITE);
+        profiler.CountDraws(2);
     };
 
-    string Upper(const string &s) {
-        string r = s;
-        std::transform(r.begin(), r.end(), r.begin(), ::toupper);
-        return r;
-    }
+    std::string_view SetterName()  const { return match.player1IsSetter ? player1Name : player2Name; }
+    std::string_view GuesserName() const { return match.player1IsSetter ? player2Name : player1Name; }
+
+    // Which role this machine plays (both, when hot-seat)
+    bool LocalIsSetter()  const { return !net.Active() || match.player1IsSetter == localIsP1; }
+    bool LocalIsGuesser() const { return !net.Active() || match.player1IsSetter != localIsP1; }
+    bool IsJoiner() const { return net.Active() && !net.IsHost(); }
+    bool SeriesFinished() const { return match.gameOver && match.currentRound >= match.settings.totalRounds; }
+
+    // ============================================================
+    // NETWORK
+    // ============================================================
+
+    void PumpNetwork() {
+        NetState before = net.State();
+        NetEvent ev = net.Poll((uint32_t)(GetTime() * 1000.0));
 
-    bool WordValid(const string &w) {
-        if (w.empty()) return false;
-        for (char c : w) {
-            if (std::isalpha((unsigned char)c)) return true;
+        if (ev == NetEvent::CONNECTED) {
+            if (net.IsHost()) {
+                netStatus = "Player 2 connected.";
+            } else {
+                NetMessage hello;
+                hello.type = NetMsg::HELLO;
+                hello.text = localName.empty() ? std::string_view("Player 2") : localName.view();
+                net.Send(hello);
+                netStatus = "Connected. Waiting for the host to start...";
+            }
+        } else if (ev == NetEvent::DISCONNECTED) {
+            remoteName.clear();
+            if (!net.IsHost() && SeriesFinished()) {
+                // A dedicated server closes the room after the last round
+                netStatus = "Series over. Room closed.";
+            } else {
+                netStatus = net.IsHost() ? "Player 2 left. Waiting for a new player..." : "Connection lost.";
+                ResetToLobby();
+            }
+        } else if (before == NetState::CONNECTING && net.State() == NetState::FAILED) {
+            netStatus = "Could not connect.";
+        }
+
+        // Session-level messages; round messages wait for their screen
+        while (net.HasMessage()) {
+            const NetMessage& m = net.Front();
+            if (m.type == NetMsg::HELLO && net.IsHost()) {
+                remoteName = m.text;
+                p2NameInput = remoteName;
+                netStatus = string(remoteName.view()) + " connected.";
+            } else if (m.type == NetMsg::CONFIG && !net.IsHost()) {
+                ApplyRemoteConfig(m);
+            } else {
+                break;
+            }
+            net.Pop();
         }
-        return false;
     }
 
-    string SetterName()  const { return player1IsSetter ? player1Name : player2Name; }
-    string GuesserName() const { return player1IsSetter ? player2Name : player1Name; }
+    // Joiner: the host started a series
+    void ApplyRemoteConfig(const NetMessage& m) {
+        match.settings.totalRounds = m.totalRounds;
+        match.settings.maxLivesSetting = m.maxLives;
+        match.settings.timeLimitSeconds = m.timeLimit;
+        ClampSettings(match.settings);
+        match.settings.starterIsP1 = m.starterIsP1;
+        match.settings.swapRoles = true;
+        match.settings.alphabet = m.alphabet < (uint8_t)AlphabetId::COUNT ? (AlphabetId)m.alphabet
+                                                                          : AlphabetId::ENGLISH;
+        localIsP1 = m.youAreP1;
+        player1Name = m.text;
+        player2Name = m.text2;
+        namesVersion++;
+        rival = RivalMode::HUMAN;
+
+        match.StartMatch();
+        ResetRoundState();
+        ResetWordInput();
+        currentScreen = GameScreen::ENTER_WORD;
+    }
 
-    void SwapRoles() {
-        player1IsSetter = !player1IsSetter;
+    void SendConfig() {
+        NetMessage m;
+        m.type = NetMsg::CONFIG;
+        m.totalRounds = (uint8_t)match.settings.totalRounds;
+        m.maxLives = (uint8_t)match.settings.maxLivesSetting;
+        m.timeLimit = (uint16_t)match.settings.timeLimitSeconds;
+        m.starterIsP1 = match.settings.starterIsP1;
+        m.youAreP1 = false;
+        m.alphabet = (uint8_t)match.settings.alphabet;
+        m.text = player1Name;
+        m.text2 = player2Name;
+        net.Send(m);
     }
 
-    void AwardScore(bool guesserWon) {
-        if (guesserWon) {
-            if (player1IsSetter) player2Score++;
-            else                 player1Score++;
-        } else {
-            if (player1IsSetter) player1Score++;
-            else                 player2Score++;
+    void SendRoundStart() {
+        NetMessage m;
+        m.type = NetMsg::ROUND_START;
+        m.length = (uint8_t)match.wordLength;
+        m.mask = match.SpaceMask();
+        m.timeCs = (uint32_t)(match.timeLeft * 100.0f);
+        m.text = match.hint;
+        net.Send(m);
+    }
+
+    void SendRoundEnd() {
+        NetMessage m;
+        m.type = NetMsg::ROUND_END;
+        m.win = match.win;
+        m.p1Score = (uint8_t)match.player1Score;
+        m.p2Score = (uint8_t)match.player2Score;
+        m.text = match.secretWord;
+        net.Send(m);
+    }
+
+    // Host, once per whole second of the round clock
+    void SendTimerSync() {
+        int second = (int)match.timeLeft;
+        if (second == lastSyncSecond) return;
+        lastSyncSecond = second;
+
+        NetMessage m;
+        m.type = NetMsg::TIMER_SYNC;
+        m.timeCs = (uint32_t)(match.timeLeft * 100.0f);
+        net.Send(m);
+    }
+
+    // ENTER_WORD: the word arrives from the other machine. True once PLAYING.
+    bool TakeRemoteWord() {
+        while (net.HasMessage()) {
+            const NetMessage& m = net.Front();
+            if (m.type == NetMsg::SET_WORD && net.IsHost()) {
+                bool usable = !LocalIsSetter() && WordValid(m.text, match.settings.alphabet) &&
+                              WordEntryFits(m.text, m.text2);
+                if (usable) {
+                    match.StartRound(m.text, m.text2);
+                    SendRoundStart();
+                }
+                net.Pop();
+                if (usable) {
+                    currentScreen = GameScreen::PLAYING;
+                    return true;
+                }
+            } else if (m.type == NetMsg::ROUND_START && !net.IsHost()) {
+                match.StartRemoteRound(m.length, m.mask, m.text, m.timeCs / 100.0f);
+                net.Pop();
+                currentScreen = GameScreen::PLAYING;
+                return true;
+            } else {
+                break; // belongs to a later screen
+            }
+        }
+        return false;
+    }
+
+    // PLAYING: guesses (host) or round deltas (joiner)
+    void TakeRoundMessages() {
+        while (net.HasMessage()) {
+            const NetMessage& m = net.Front();
+            if (net.IsHost()) {
+                if (m.type != NetMsg::GUESS) break;
+                if (!match.gameOver && !LocalIsGuesser()) ProcessGuess(m.letter);
+            } else if (m.type == NetMsg::REVEAL) {
+                GuessResult result = (GuessResult)m.result;
+                match.ApplyReveal(m.letter, m.mask, m.lives, result);
+                StartGuessAnimation(result);
+            } else if (m.type == NetMsg::TIMER_SYNC) {
+                if (!match.gameOver) match.timeLeft = m.timeCs / 100.0f;
+            } else if (m.type == NetMsg::ROUND_END) {
+                match.ApplyRoundEnd(m.win, m.p1Score, m.p2Score, m.text);
+            } else {
+                break; // next round: waits until NEXT is pressed
+            }
+            net.Pop();
         }
     }
 
     // ============================================================
-    // START SCREEN
+    // SESSION SNAPSHOT
     // ============================================================
+    SessionSnapshot CaptureSnapshot() const {
+        SessionSnapshot s;
+        ClearSnapshot(s);
+
+        // The user's settings, not the ones a vs-computer series forces
+        MatchSettings ms = match.settings;
+        if (userSettings.saved) {
+            ms.starterIsP1 = userSettings.starterIsP1;
+            ms.swapRoles = userSettings.swapRoles;
+            ms.alphabet = userSettings.alphabet;
+        }
+        SnapshotString(s.player1, player1Name);
+        SnapshotString(s.player2, player2Name);
+        s.totalRounds = (uint8_t)ms.totalRounds;
+        s.maxLives = (uint8_t)ms.maxLivesSetting;
+        s.timeLimit = (uint16_t)ms.timeLimitSeconds;
+        s.alphabet = (uint8_t)ms.alphabet;
+        s.scoring = (uint8_t)ms.scoring;
+        s.rival = (uint8_t)rival;
+        s.difficulty = (uint8_t)difficulty;
+        if (soundEnabled) s.flags |= SNAP_SOUND;
+        if (musicEnabled) s.flags |= SNAP_MUSIC;
+        if (ms.starterIsP1) s.flags |= SNAP_STARTER_P1;
+        if (ms.swapRoles) s.flags |= SNAP_SWAP_ROLES;
+
+        // Only a hot-seat / computer series can be resumed by this machine alone
+        bool inMatch = !net.Active() && kiosk.match < 0 &&
+                       (currentScreen == GameScreen::ENTER_WORD || currentScreen == GameScreen::PLAYING);
+        if (inMatch) {
+            s.flags |= SNAP_IN_MATCH;
+            if (match.player1IsSetter) s.flags |= SNAP_P1_IS_SETTER;
+            s.screen = (uint8_t)currentScreen;
+            s.currentRound = (uint8_t)match.currentRound;
+            s.player1Score = (uint16_t)match.player1Score;
+            s.player2Score = (uint16_t)match.player2Score;
+            if (currentScreen == GameScreen::PLAYING) {
+                if (match.gameOver) s.flags |= SNAP_ROUND_OVER;
+                if (match.win) s.flags |= SNAP_ROUND_WON;
+                s.lives = (uint8_t)match.lives;
+                s.timeLeft = match.timeLeft;
+                s.triedMask = match.letters.triedMask;
+                SnapshotString(s.secretWord, match.secretWord);
+                SnapshotString(s.hint, match.hint);
+            }
+        }
 
-    void UpdateStart() {
-        // --- Button Geometry ---
-        int btnW = 260;
-        int btnH = 60;
-        int btnX = screenWidth / 2 - btnW / 2; // Horizontally centered
-
-        // --- Stacked Buttons Y Positions (Centered Below Figure) ---
-        int gap = 20;
-        int yStart = screenHeight / 2 + 100; // Start the stack around the middle bottom
-        
-        // Button 1: START GAME
-        int btnY1 = yStart; 
-        Rectangle btnStartRect = { (float)btnX, (float)btnY1, (float)btnW, (float)btnH };
-        
-        // Button 2: SOUND SETTINGS
-        int btnY2 = btnY1 + btnH + gap;
-        Rectangle btnSoundRect = { (float)btnX, (float)btnY2, (float)btnW, (float)btnH };
-        
-        // Button 3: LEADERBOARD
-        int btnY3 = btnY2 + btnH + gap;
-        Rectangle btnLeaderRect = { (float)btnX, (float)btnY3, (float)btnW, (float)btnH };
+        SealSnapshot(s);
+        return s;
+    }
 
+    // Once per frame: a new snapshot on a screen change, a guess or a round
+    // ending. The write itself happens on the writer's thread.
+    void TrackSnapshot() {
+        bool changed = currentScreen != snapScreen || match.letters.triedMask != snapTried ||
+                       match.roundSerial != snapSerial || match.gameOver != snapOver;
+        if (!changed) return;
+        snapScreen = currentScreen;
+        snapTried = match.letters.triedMask;
+        snapSerial = match.roundSerial;
+        snapOver = match.gameOver;
+        snapshots.Submit(CaptureSnapshot());
+    }
 
-        Vector2 mouse = GetMousePosition();
+    // ============================================================
+    // TELEMETRY
+    // ============================================================
+    TelemetryEvent MakeEvent(TelemetryKind kind) const {
+        TelemetryEvent e;
+        e.kind = kind;
+        e.time = clock.Now();
+        e.round = (uint8_t)match.currentRound;
+        e.maxLives = (uint8_t)match.MaxLives();
+        e.wrong = (uint8_t)match.lives;
+        return e;
+    }
 
-        bool hoverStart = CheckCollisionPointRec(mouse, btnStartRect);
-        bool clickStart = hoverStart && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
-        
-        bool hoverSound = CheckCollisionPointRec(mouse, btnSoundRect);
-        bool clickSound = hoverSound && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
-        
-        bool hoverLeader = CheckCollisionPointRec(mouse, btnLeaderRect);
-        bool clickLeader = hoverLeader && IsMouseButtonPressed(MOUSE_LEFT_BUTTON);
+    // Once per frame: round starts and ends, and frame-time percentiles once
+    // per profiler window
+    void TrackTelemetry() {
+        if (match.roundSerial != telemetrySerial) {
+            telemetrySerial = match.roundSerial;
+            telemetryOver = match.gameOver;
+            lastGuessAt = clock.Now();
+        }
+        if (match.gameOver && !telemetryOver) {
+            telemetryOver = true;
+            // The joiner only mirrors the host's round; AwardScore ran there
+            if (!IsJoiner()) {
+                TelemetryEvent e = MakeEvent(TelemetryKind::ROUND_END);
+                e.result = match.win ? 1 : 0;
+                e.timedOut = (!match.win && match.lives < match.MaxLives()) ? 1 : 0;
+                e.setterAward = (int8_t)match.lastAward.setter;
+                e.guesserAward = (int8_t)match.lastAward.guesser;
+                telemetry.Record(e);
+            }
+        }
 
-        bool keyStart = IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE);
+        if (clock.Frames() % FrameProfiler::HISTORY == 0 && profiler.FrameCount() > 0) {
+            FrameProfiler::Stats frame, cpu;
+            profiler.Summary(frame, cpu);
+            TelemetryEvent e = MakeEvent(TelemetryKind::FRAMES);
+            e.code = (uint32_t)profiler.FrameCount();
+            float v[6] = { frame.p50, frame.p99, frame.max, cpu.p50, cpu.p99, cpu.max };
+            std::copy(v, v + 6, e.value);
+            telemetry.Record(e);
+        }
+    }
 
-        if (clickStart || keyStart) {
-            PlayClick();
-            currentScreen = GameScreen::SETTINGS;
+    void RecordGuess(uint32_t letter, GuessResult result) {
+        if (!telemetry.Active() || result == GuessResult::ALREADY_TRIED) return;
+        TelemetryEvent e = MakeEvent(TelemetryKind::GUESS);
+        e.code = FoldCase(letter);
+        e.result = (uint8_t)result;
+        e.value[0] = (float)((clock.Now() - lastGuessAt) * 1000.0);
+        lastGuessAt = clock.Now();
+        telemetry.Record(e);
+    }
+
+    // ESC / BACK mid-series: the joiner has no settings of its own; a kiosk
+    // match goes back into the bracket's queue
+    void LeaveToSettings() {
+        RestoreUserSettings();
+        if (kiosk.match >= 0) {
+            tournament.ReleaseKiosk(kiosk.match);
+            EndKioskSeries();
             return;
         }
-        
-        // Handle sound settings button click
-        if (clickSound) {
-            PlayClick();
-            currentScreen = GameScreen::SOUND_SETTINGS;
-            soundSettingsFieldIndex = 0;
-            return;
+        currentScreen = IsJoiner() ? GameScreen::START : GameScreen::SETTINGS;
+    }
+
+    // ============================================================
+    // RECORD / REPLAY
+    // ============================================================
+
+    void RecordFrame() {
+        recorder.Frame(clock.DeltaMicros());
+        for (const InputEvent& ev : input) {
+            // Keyboard clicks as keys: they replay even if the layout moved
+            int key = -1;
+            if (ev.kind == InputKind::CLICK && currentScreen == GameScreen::PLAYING) {
+                key = keyboard.HitTest(ev.pos);
+            }
+            recorder.Input(ev, key);
         }
-        
-        // Handle LEADERBOARD button click
-        if (clickLeader) {
-            PlayClick();
-            currentScreen = GameScreen::LEADERBOARD;
+    }
+
+    void ReplayNextFrame() {
+        if (!replay.Next(replayFrame)) {
+            TraceLog(LOG_INFO, "REPLAY: finished after %llu frames (%.1f s), %d divergences",
+                     (unsigned long long)clock.Frames(), clock.Now(), replayDivergences);
+            replay.Close();
+            pollInput = true;
+            clock.Advance(GetFrameTime());
             return;
         }
 
+        clock.AdvanceMicros(replayFrame.dtUs);
+        pollInput = false;
+        input.Clear();
+        for (int i = 0; i < replayFrame.count; ++i) {
+            InputEvent ev = replayFrame.events[i];
+            if (replayFrame.keyIndex[i] >= 0) ev.pos = keyboard.KeyCenter(replayFrame.keyIndex[i]);
+            input.Push(ev);
+        }
+        replayExpectSettings = replayFrame.hasSettings;
+    }
+
+    ReplaySettings CurrentReplaySettings() const {
+        ReplaySettings s;
+        s.rounds = (uint8_t)match.settings.totalRounds;
+        s.lives = (uint8_t)match.settings.maxLivesSetting;
+        s.timeLimit = (uint16_t)match.settings.timeLimitSeconds;
+        s.flags = (match.settings.starterIsP1 ? 1 : 0) | (match.settings.swapRoles ? 2 : 0) |
+                  ((int)match.settings.scoring << 2);
+        s.rival = (uint8_t)rival;
+        s.difficulty = (uint8_t)difficulty;
+        s.alphabet = (uint8_t)match.settings.alphabet;
+        return s;
+    }
+
+    // A series is starting: log its settings, or check them against the log
+    void CheckReplaySettings() {
+        ReplaySettings s = CurrentReplaySettings();
+        if (recorder.IsOpen()) recorder.Settings(s);
+        if (!replay.IsOpen()) return;
+
+        if (!replayExpectSettings) ReplayDiverged("a series started that the log does not have");
+        else if (s != replayFrame.settings) ReplayDiverged("the series settings differ");
+        replayExpectSettings = false;
+    }
+
+    void ReplayDiverged(const char* what) {
+        replayDivergences++;
+        replayExpectSettings = false;
+        TraceLog(LOG_WARNING, "REPLAY: frame %llu: %s", (unsigned long long)clock.Frames(), what);
+    }
+
+    // ============================================================
+    // RETAINED LAYERS
+    // ============================================================
+
+    // Render-texture bakes reset the view transform, so all of them happen
+    // before the screen starts drawing through the canvas camera
+    void PrepareLayers() {
+        if (screenLayer.NeedsBake((int)currentScreen, GetScreenWidth(), GetScreenHeight())) {
+            BakeScreenLayer();
+        }
+        if (currentScreen == GameScreen::PLAYING || currentScreen == GameScreen::SUMMARY) {
+            hangmanMesh.Build(view.Scale()); // no-op unless the window was rescaled
+        }
+        if (currentScreen == GameScreen::PLAYING) {
+            keyboard.SetAlphabet(match.settings.alphabet); // relayout only on a change
+            if (!keyboard.HasAtlas()) keyboard.BuildAtlas(fonts);
+        }
+    }
+
+    void BakeScreenLayer() {
+        // Baked at window resolution (so the chrome stays sharp when scaled),
+        // drawn in canvas units through the view; the letterbox gets the clear colour
+        screenLayer.BeginBake((int)currentScreen, GetScreenWidth(), GetScreenHeight());
+
+        if (currentScreen == GameScreen::START) {
+            // Placeholder colour until start_bg.jpg has been uploaded
+            ClearBackground(startBg.id != 0 ? BLACK : BG_COLOR);
+            BeginMode2D(view.Camera());
+
+            // Draw background image stretched to window
+            if (startBg.id != 0) {
+                Rectangle src = { 0, 0, (float)startBg.width, (float)startBg.height };
+                Rectangle dst = { 0, 0, (float)screenWidth, (float)screenHeight };
+                DrawTexturePro(startBg, src, dst, Vector2{0, 0}, 0.0f, WHITE);
+            }
+
+            // Dark overlay to make text readable
+            DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.35f));
+        } else {
+            ClearBackground(BG_COLOR);
+            BeginMode2D(view.Camera());
+
+            auto [cardX, cardY, cardW, cardH] = layout.Card();
+
+            DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
+            DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
+            DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
+
+            if (currentScreen == GameScreen::PLAYING) {
+                // ---- Left sidebar: round + scores ----
+                const Rectangle& sidebar = layout[UiRect::PLAY_SIDEBAR];
+                DrawRectangleRec(sidebar, LIGHTGRAY);
+                DrawRectangleLinesEx(sidebar, 1.0f, BLACK);
 
-        // ESC from start screen quits the game
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            CloseWindow();
+                // Header bar
+                DrawRectangleRec(Rectangle{ sidebar.x, sidebar.y, sidebar.width, 40.0f }, BLACK);
+            }
         }
+
+        EndMode2D();
+        screenLayer.EndBake();
     }
 
-    void DrawStart() {
-        ClearBackground(BLACK);
+    // ============================================================
+    // START SCREEN
+    // ============================================================
 
-        // Draw background image stretched to window
-        if (startBg.id != 0) {
-            Rectangle src = { 0, 0, (float)startBg.width, (float)startBg.height };
-            Rectangle dst = { 0, 0, (float)screenWidth, (float)screenHeight };
-            DrawTexturePro(startBg, src, dst, Vector2{0, 0}, 0.0f, WHITE);
+    void UpdateStart() {
+        const Rectangle& btnStartRect  = layout[UiRect::START_PLAY];
+        const Rectangle& btnSoundRect  = layout[UiRect::START_SOUND];
+        const Rectangle& btnLeaderRect = layout[UiRect::START_LEADERBOARD];
+
+        for (const InputEvent& ev : input) {
+            bool click = (ev.kind == InputKind::CLICK);
+            bool clickStart  = click && CheckCollisionPointRec(ev.pos, btnStartRect);
+            bool clickSound  = click && CheckCollisionPointRec(ev.pos, btnSoundRect);
+            bool clickLeader = click && CheckCollisionPointRec(ev.pos, btnLeaderRect);
+
+            bool keyStart = (ev.kind == InputKind::CONFIRM) || ev.IsChar(' ');
+
+            if (clickStart || keyStart) {
+                PlayClick();
+                if (IsJoiner()) return; // the host starts the series
+                currentScreen = GameScreen::SETTINGS;
+                return;
+            }
+            
+            // Handle sound settings button click
+            if (clickSound) {
+                PlayClick();
+                currentScreen = GameScreen::SOUND_SETTINGS;
+                soundSettingsFieldIndex = 0;
+                return;
+            }
+            
+            // Handle LEADERBOARD button click
+            if (clickLeader) {
+                PlayClick();
+                leaderboard.Refresh(); // other kiosks' scores since the last record
+                currentScreen = GameScreen::LEADERBOARD;
+                return;
+            }
+
+            // T: back to a running tournament's bracket
+            if (tournament.Active() && (ev.IsChar('t') || ev.IsChar('T'))) {
+                PlayClick();
+                currentScreen = GameScreen::TOURNAMENT;
+                return;
+            }
+
+            // ESC from start screen quits the game
+            if (ev.kind == InputKind::CANCEL) {
+                CloseWindow();
+            }
         }
+    }
 
-        // Dark overlay to make text readable
-        DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, 0.35f));
+    void DrawStart() {
+        // Background image + dark overlay come from the screen layer
 
         // --- Title: SPLIT HANG MAN (Top Center) ---
         
@@ -434,8 +1294,8 @@ private:
         int titleY = 62; 
         
         // Calculate size of "HANG" and "MAN"
-        Vector2 sizeHang = MeasureTextEx(uiFont, "HANG", (float)titleFontSize, titleSpacing);
-        Vector2 sizeMan = MeasureTextEx(uiFont, "MAN", (float)titleFontSize, titleSpacing);
+        Vector2 sizeHang = textCache.Measure("HANG", (float)titleFontSize, titleSpacing);
+        Vector2 sizeMan = textCache.Measure("MAN", (float)titleFontSize, titleSpacing);
         
         // Desired gap for the rope/gallows image
         int gapWidth = 30; // Small gap
@@ -462,27 +1322,9 @@ private:
         // Draw MAN (Right side)
         DrawTextSmooth("MAN", (int)xMan, titleY, titleFontSize, titleColor, titleSpacing); 
 
-        // --- Button Geometry ---
-        int btnW = 260;
-        int btnH = 60;
-        int btnX = screenWidth / 2 - btnW / 2; // Horizontally centered
-
-        // --- Stacked Buttons Y Positions ---
-        int gap = 20;
-        int yStart = screenHeight / 2 + 100; // Start the stack around the middle bottom
-        
-        // Button 1: START GAME
-        int btnY1 = yStart; 
-        Rectangle btnStartRect = { (float)btnX, (float)btnY1, (float)btnW, (float)btnH };
-        
-        // Button 2: SOUND SETTINGS
-        int btnY2 = btnY1 + btnH + gap;
-        Rectangle btnSoundRect = { (float)btnX, (float)btnY2, (float)btnW, (float)btnH };
-        
-        // Button 3: LEADERBOARD
-        int btnY3 = btnY2 + btnH + gap;
-        Rectangle btnLeaderRect = { (float)btnX, (float)btnY3, (float)btnW, (float)btnH };
-
+        const Rectangle& btnStartRect  = layout[UiRect::START_PLAY];
+        const Rectangle& btnSoundRect  = layout[UiRect::START_SOUND];
+        const Rectangle& btnLeaderRect = layout[UiRect::START_LEADERBOARD];
 
         Vector2 mouse = GetMousePosition();
         int fontSize = 26;
@@ -500,11 +1342,11 @@ private:
 
             int currentFontSize = 26;
             float currentSpacing = 2.0f;
-            Vector2 ts = MeasureTextEx(uiFont, label, (float)currentFontSize, currentSpacing);
+            Vector2 ts = textCache.Measure(label, (float)currentFontSize, currentSpacing);
             float tx = r.x + (r.width  - ts.x) / 2.0f;
             float ty = r.y + (r.height - ts.y) / 2.0f;
 
-            DrawTextEx(uiFont, label, Vector2{tx, ty}, (float)currentFontSize, currentSpacing, textColor);
+            fonts.Queue(label, Vector2{tx, ty}, (float)currentFontSize, currentSpacing, textColor);
         };
 
         // --- Draw START GAME button (Primary, Top of Stack) ---
@@ -515,13 +1357,13 @@ private:
         DrawRectangleRoundedLines(btnStartRect, 0.3f, 10, BLACK);
 
         const char* btnTextStart = "START GAME";
-        Vector2 textSizeStart = MeasureTextEx(uiFont, btnTextStart, (float)fontSize, spacing);
+        Vector2 textSizeStart = textCache.Measure(btnTextStart, (float)fontSize, spacing);
 
-        int textXStart = btnX + (btnW - (int)textSizeStart.x) / 2;
-        int textYStart = btnY1 + (btnH - (int)textSizeStart.y) / 2;
-        DrawTextEx(uiFont, btnTextStart,
-                   Vector2{ (float)textXStart, (float)textYStart },
-                   (float)fontSize, spacing, textColor);
+        UiBox startBox = layout.Box(UiRect::START_PLAY);
+        int textXStart = startBox.x + (startBox.w - (int)textSizeStart.x) / 2;
+        int textYStart = startBox.y + (startBox.h - (int)textSizeStart.y) / 2;
+        fonts.Queue(btnTextStart, Vector2{ (float)textXStart, (float)textYStart },
+                    (float)fontSize, spacing, textColor);
                    
         // --- Draw SOUND SETTINGS button (Middle of Stack) ---
         bool hoverSound = CheckCollisionPointRec(mouse, btnSoundRect);
@@ -532,7 +1374,9 @@ private:
         drawSecondaryButton(btnLeaderRect, "LEADERBOARD", hoverLeader); 
 
         // --- Footer text ---
-        // (Section intentionally empty)
+        if (!netStatus.empty()) {
+            DrawTextCentered(netStatus, screenWidth / 2, (int)(btnLeaderRect.y + btnLeaderRect.height) + 24, 20, RAYWHITE);
+        }
     }
 
     // ============================================================
@@ -540,151 +1384,209 @@ private:
     // ============================================================
 
     void UpdateSettings() {
-        // Navigate fields with UP/DOWN (0..4) - NO SOUND
-        if (IsKeyPressed(KEY_UP)) {
-            settingsFieldIndex--;
-            if (settingsFieldIndex < 0) settingsFieldIndex = 4;
-        }
-        if (IsKeyPressed(KEY_DOWN)) {
-            settingsFieldIndex++;
-            if (settingsFieldIndex > 4) settingsFieldIndex = 0;
-        }
-
-        // Edit based on current field: (TYPING AND BACKSPACE - NO SOUND)
-        int ch = GetCharPressed();
-        while (ch > 0) {
-            char c = (char)ch;
-
-            if (settingsFieldIndex == 0) {
-                if (p1NameInput.size() < 15 && c >= 32 && c <= 126) {
-                    p1NameInput.push_back(c);
-                }
-            } else if (settingsFieldIndex == 1) {
-                if (p2NameInput.size() < 15 && c >= 32 && c <= 126) {
-                    p2NameInput.push_back(c);
-                }
-            }
-            ch = GetCharPressed();
-        }
+        // Geometry for card + buttons
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
-        if (IsKeyPressed(KEY_BACKSPACE)) {
-            if (settingsFieldIndex == 0 && !p1NameInput.empty()) {
-                p1NameInput.pop_back();
-            }
-            else if (settingsFieldIndex == 1 && !p2NameInput.empty()) {
-                p2NameInput.pop_back();
-            }
-        }
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& startBtn = layout[UiRect::FOOTER_RIGHT];
 
-        // Left/right to change non-text fields (NO SOUND)
-        if (settingsFieldIndex == 2) { // starter
-            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT)) {
-                starterIsP1 = !starterIsP1;
-            }
-        } else if (settingsFieldIndex == 3) { // rounds
-            if (IsKeyPressed(KEY_LEFT)) {
-                if (totalRounds > 1) { totalRounds--; }
-            }
-            if (IsKeyPressed(KEY_RIGHT)) {
-                if (totalRounds < 10) { totalRounds++; }
-            }
-        } else if (settingsFieldIndex == 4) { // time per round
-            if (IsKeyPressed(KEY_LEFT)) {
-                if (timeLimitSeconds > 10) { timeLimitSeconds -= 10; }
-            }
-            if (IsKeyPressed(KEY_RIGHT)) {
-                if (timeLimitSeconds < 300) { timeLimitSeconds += 10; }
-            }
-        }
+        for (const InputEvent& ev : input) {
+            switch (ev.kind) {
+                // Navigate fields with UP/DOWN (0..7) - NO SOUND
+                case InputKind::NAV_UP:
+                    settingsFieldIndex--;
+                    if (settingsFieldIndex < 0) settingsFieldIndex = SETTINGS_FIELD_COUNT - 1;
+                    break;
+                case InputKind::NAV_DOWN:
+                    settingsFieldIndex++;
+                    if (settingsFieldIndex >= SETTINGS_FIELD_COUNT) settingsFieldIndex = 0;
+                    break;
 
-        // Geometry for card + buttons
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
+                // Edit based on current field: (TYPING AND BACKSPACE - NO SOUND)
+                case InputKind::LETTER:
+                case InputKind::TEXT: {
+                    int c = ev.codepoint;
+                    if (c < 32 || c > 126) break;
+                    if (settingsFieldIndex == 0 && p1NameInput.size() < NAME_MAX_CHARS) {
+                        p1NameInput.push_back((char)c);
+                    } else if (settingsFieldIndex == 1 && p2NameInput.size() < NAME_MAX_CHARS) {
+                        p2NameInput.push_back((char)c);
+                    }
+                    break;
+                }
+                case InputKind::BACKSPACE:
+                    if (settingsFieldIndex == 0 && !p1NameInput.empty()) {
+                        p1NameInput.pop_back();
+                    }
+                    else if (settingsFieldIndex == 1 && !p2NameInput.empty()) {
+                        p2NameInput.pop_back();
+                    }
+                    break;
 
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
+                // Left/right to change non-text fields (NO SOUND)
+                case InputKind::NAV_LEFT:
+                case InputKind::NAV_RIGHT: {
+                    bool right = (ev.kind == InputKind::NAV_RIGHT);
+                    if (settingsFieldIndex == 2) { // starter
+                        match.settings.starterIsP1 = !match.settings.starterIsP1;
+                    } else if (settingsFieldIndex == 3) { // rounds
+                        if (!right && match.settings.totalRounds > 1) { match.settings.totalRounds--; }
+                        if (right && match.settings.totalRounds < MatchSettings::MAX_ROUNDS) { match.settings.totalRounds++; }
+                    } else if (settingsFieldIndex == 4) { // time per round
+                        const int step = RuntimeTimer::STEP_SECONDS;
+                        if (!right && match.settings.timeLimitSeconds > RuntimeTimer::MIN_SECONDS) { match.settings.timeLimitSeconds -= step; }
+                        if (right && match.settings.timeLimitSeconds < RuntimeTimer::MAX_SECONDS) { match.settings.timeLimitSeconds += step; }
+                    } else if (settingsFieldIndex == 5) { // rival (computer needs words.dict)
+                        int r = (int)rival + (right ? 1 : -1);
+                        if (r < 0) r = (int)RivalMode::COMPUTER_GUESSER;
+                        if (r > (int)RivalMode::COMPUTER_GUESSER) r = 0;
+                        rival = dictionary.IsOpen() ? (RivalMode)r : RivalMode::HUMAN;
+                    } else if (settingsFieldIndex == 6) { // computer word difficulty
+                        int d = (int)difficulty + (right ? 1 : -1);
+                        if (d >= 0 && d <= (int)WordDifficulty::HARD) difficulty = (WordDifficulty)d;
+                    } else if (settingsFieldIndex == 7) { // alphabet
+                        int a = (int)match.settings.alphabet + (right ? 1 : -1);
+                        if (a < 0) a = (int)AlphabetId::COUNT - 1;
+                        if (a >= (int)AlphabetId::COUNT) a = 0;
+                        match.settings.alphabet = (AlphabetId)a;
+                    }
+                    break;
+                }
 
-        Rectangle backBtn  = { (float)(cardX + 80), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle startBtn = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
+                // Mouse selection of fields + buttons
+                case InputKind::CLICK: {
+                    // Click on fields (NO SOUND)
+                    int xValue = cardX + 550;
+                    int yStart = cardY + 120;
+                    int dy = 48;
+
+                    for (int i = 0; i < SETTINGS_FIELD_COUNT; i++) {
+                        int y = yStart + i * dy;
+                        Rectangle box = { (float)(xValue - 10), (float)(y - 5), 320.0f, 36.0f };
+                        if (CheckCollisionPointRec(ev.pos, box)) {
+                            settingsFieldIndex = i;
+                        }
+                    }
 
-        Vector2 mouse = GetMousePosition();
+                    // Click on BACK button (SOUND)
+                    if (CheckCollisionPointRec(ev.pos, backBtn)) {
+                        PlayClick();
+                        currentScreen = GameScreen::START;
+                        return;
+                    }
 
-        // Mouse selection of fields + buttons
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            // Click on fields (NO SOUND)
-            int xValue = cardX + 550;
-            int yStart = cardY + 120;
-            int dy = 60;
-
-            for (int i = 0; i <= 4; i++) {
-                int y = yStart + i * dy;
-                Rectangle box = { (float)(xValue - 10), (float)(y - 5), 320.0f, 36.0f };
-                if (CheckCollisionPointRec(mouse, box)) {
-                    settingsFieldIndex = i;
+                    // Click on START ROUND button (SOUND)
+                    if (CheckCollisionPointRec(ev.pos, startBtn)) {
+                        PlayClick();
+                        ApplySettingsAndStartRound();
+                        return;
+                    }
+                    break;
                 }
-            }
 
-            // Click on BACK button (SOUND)
-            if (CheckCollisionPointRec(mouse, backBtn)) {
-                PlayClick();
-                currentScreen = GameScreen::START;
-                return;
-            }
+                // ENTER: apply settings & start game (SOUND)
+                case InputKind::CONFIRM:
+                    PlayClick();
+                    ApplySettingsAndStartRound();
+                    return;
 
-            // Click on START ROUND button (SOUND)
-            if (CheckCollisionPointRec(mouse, startBtn)) {
-                PlayClick();
-                ApplySettingsAndStartRound();
-                return;
+                // ESC from settings: back to START screen (SOUND)
+                case InputKind::CANCEL:
+                    PlayClick();
+                    currentScreen = GameScreen::START;
+                    return;
             }
         }
-
-        // ENTER: apply settings & start game (SOUND)
-        if (IsKeyPressed(KEY_ENTER)) {
-            PlayClick();
-            ApplySettingsAndStartRound();
-        }
-
-        // ESC from settings: back to START screen (SOUND)
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            PlayClick();
-            currentScreen = GameScreen::START;
-        }
     }
 
     void ApplySettingsAndStartRound() {
+        if (net.Active()) {
+            if (!net.Connected()) {
+                settingsMessage = "Waiting for player 2 to connect...";
+                return;
+            }
+            rival = RivalMode::HUMAN;
+            if (!remoteName.empty()) p2NameInput = remoteName;
+        }
+        settingsMessage.clear();
+
         if (!p1NameInput.empty()) player1Name = p1NameInput;
         else player1Name = "Player 1";
 
-        if (!p2NameInput.empty()) player2Name = p2NameInput;
+        if (rival != RivalMode::HUMAN) player2Name = "COMPUTER";
+        else if (!p2NameInput.empty()) player2Name = p2NameInput;
         else player2Name = "Player 2";
+        namesVersion++;
 
-        player1IsSetter = starterIsP1;
-        player1Score = 0;
-        player2Score = 0;
-        currentRound = 1;
+        BeginSeries();
+    }
 
+    // New series between player1Name and player2Name under the current settings
+    void BeginSeries() {
+        ApplyRivalOverrides();
+        CheckReplaySettings();
+
+        match.StartMatch();
         ResetRoundState();
         ResetWordInput();
-        currentScreen = GameScreen::ENTER_WORD;
+        if (telemetry.Active()) {
+            TelemetryEvent e = MakeEvent(TelemetryKind::MATCH_START);
+            e.code = (uint32_t)match.settings.totalRounds;
+            e.value[0] = (float)match.settings.timeLimitSeconds;
+            e.label = ALPHABET_NAMES[(int)match.settings.alphabet];
+            e.label2 = SCORING_NAMES[(int)match.settings.scoring];
+            telemetry.Record(e);
+        }
+        if (net.Active()) SendConfig();
+        BeginRoundSetup();
     }
 
-    void DrawSettings() {
-        ClearBackground(BG_COLOR);
+    // Next step after the round state is reset: word entry, or a dictionary pick
+    void BeginRoundSetup() {
+        if (rival == RivalMode::COMPUTER_SETTER && StartComputerRound()) {
+            currentScreen = GameScreen::PLAYING;
+        } else {
+            currentScreen = GameScreen::ENTER_WORD;
+        }
+    }
 
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
+    DictQuery DifficultyQuery() const {
+        DictQuery q;
+        switch (difficulty) {
+            case WordDifficulty::EASY:   // long words, many distinct common letters
+                q.minLen = 6; q.maxLen = 12; q.minDistinct = 5; q.maxDistinct = 10;
+                q.excludeMask = LetterMask("JQXZKV", 6);
+                break;
+            case WordDifficulty::MEDIUM:
+                q.minLen = 5; q.maxLen = 9; q.minDistinct = 4; q.maxDistinct = 7;
+                break;
+            case WordDifficulty::HARD:   // short words, few letters to find
+                q.minLen = 3; q.maxLen = 6; q.minDistinct = 3; q.maxDistinct = 5;
+                break;
+        }
+        return q;
+    }
 
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
+    bool StartComputerRound() {
+        char word[DICT_MAX_LEN + 1];
+        DictQuery q = DifficultyQuery();
+        if (!dictionary.Pick(q, wordRng, word)) {
+            // Nothing in this difficulty band: any word at all
+            if (!dictionary.Pick(DictQuery{}, wordRng, word)) return false;
+        }
+
+        int len = (int)std::strlen(word);
+        int distinct = 0;
+        for (uint32_t m = LetterMask(word, len); m != 0; m &= m - 1) distinct++;
+
+        char hint[48];
+        std::snprintf(hint, sizeof(hint), "%d letters, %d different", len, distinct);
+        match.StartRound(word, hint);
+        return true;
+    }
+
+    void DrawSettings() {
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
         // Title
         DrawTextSmooth("BEFORE YOU HANG PAGE", cardX + 340, cardY + 30, 32, BLACK, 2.0f);
@@ -692,9 +1594,9 @@ private:
         int xLabel = cardX + 140;
         int xValue = cardX + 550;
         int yStart = cardY + 120;
-        int dy = 60;
+        int dy = 48;
 
-        auto drawField = [&](int index, const char* label, const string& value) {
+        auto drawField = [&](int index, const char* label, const char* value) {
             int y = yStart + index * dy;
 
             DrawTextSmooth(label, xLabel, y, 24, BLACK, 2.0f);
@@ -715,20 +1617,22 @@ private:
             // Draw field text
             int valueFontSize = 22;
             float valueSpacing = 1.5f;
-            DrawTextSmooth(value.c_str(), xValue, y, valueFontSize, BLACK, valueSpacing);
+            DrawTextSmooth(value, xValue, y, valueFontSize, BLACK, valueSpacing);
 
             // Blinking cursor for editable text fields (name fields: 0 and 1)
             if (settingsFieldIndex == index && (index == 0 || index == 1)) {
-                float t = GetTime();
+                float t = (float)clock.Now();
                 bool showCursor = ((int)(t * 2)) % 2 == 0;  // blink ~2 times per second
 
                 if (showCursor) {
-                    Vector2 textSize = MeasureTextEx(
-                        uiFont, value.c_str(),
-                        (float)valueFontSize, valueSpacing
+                    const TextLayout& layout = textCache.Get(
+                        value, (float)valueFontSize, valueSpacing
                     );
+                    // Pen position after the last glyph, minus its trailing spacing
+                    float textEnd = layout.glyphX.back();
+                    if (layout.glyphX.size() > 1) textEnd -= valueSpacing;
 
-                    int cursorX = xValue + (int)textSize.x + 3;
+                    int cursorX = xValue + (int)textEnd + 3;
                     int cursorY = y - 2;
                     int cursorH = valueFontSize + 6;
 
@@ -737,31 +1641,49 @@ private:
             }
         };
 
-        drawField(0, "YOUR COOL NAME :", p1NameInput);
-        drawField(1, "SIDEKICK / RIVAL NAME :", p2NameInput);
+        drawField(0, "YOUR COOL NAME :", p1NameInput.c_str());
+        drawField(1, "SIDEKICK / RIVAL NAME :", p2NameInput.c_str());
 
         {
-            string starterStr = starterIsP1 ? player1Name : player2Name;
-            drawField(2, "WHO HIDES THE WORD FIRST? :", starterStr);
+            string starterStr(match.settings.starterIsP1 ? player1Name.view() : player2Name.view());
+            if (rival == RivalMode::COMPUTER_SETTER) starterStr = "COMPUTER (every round)";
+            if (rival == RivalMode::COMPUTER_GUESSER) starterStr = string(player1Name.view()) + " (every round)";
+            drawField(2, "WHO HIDES THE WORD FIRST? :", starterStr.c_str());
         }
 
         {
-            string roundsStr = std::to_string(totalRounds);
-            drawField(3, "HOW MANY BATTLES? : ", roundsStr);
+            string roundsStr = std::to_string(match.settings.totalRounds);
+            drawField(3, "HOW MANY BATTLES? : ", roundsStr.c_str());
         }
 
         {
-            string timeStr = std::to_string(timeLimitSeconds) + " seconds";
-            drawField(4, "TIME PRESSURE PER ROUND :", timeStr);
+            string timeStr = std::to_string(match.settings.timeLimitSeconds) + " seconds";
+            drawField(4, "TIME PRESSURE PER ROUND :", timeStr.c_str());
         }
 
-        // Buttons at bottom: BACK and START ROUND
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
+        {
+            string rivalStr = "HUMAN";
+            if (rival == RivalMode::COMPUTER_SETTER) rivalStr = "COMPUTER SETS WORDS";
+            else if (rival == RivalMode::COMPUTER_GUESSER) rivalStr = "COMPUTER GUESSES";
+            else if (!dictionary.IsOpen()) rivalStr = "HUMAN (no words.dict)";
+            drawField(5, "RIVAL :", rivalStr.c_str());
+        }
 
-        Rectangle backBtn  = { (float)(cardX + 80), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle startBtn = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
+        {
+            static const char* DIFFICULTY_NAMES[] = { "EASY", "MEDIUM", "HARD" };
+            drawField(6, "COMPUTER WORD DIFFICULTY :", DIFFICULTY_NAMES[(int)difficulty]);
+        }
+
+        {
+            // The dictionary and solver are A-Z only
+            const char* alphabetStr = ALPHABET_NAMES[(int)match.settings.alphabet];
+            if (rival != RivalMode::HUMAN) alphabetStr = "ENGLISH (computer rival)";
+            drawField(7, "LETTERS :", alphabetStr);
+        }
+
+        // Buttons at bottom: BACK and START ROUND
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& startBtn = layout[UiRect::FOOTER_RIGHT];
 
         Vector2 mouse = GetMousePosition();
 
@@ -771,6 +1693,12 @@ private:
         string tip = "Tip: Use ↑/↓ or click to change fields. ENTER or START button to begin.";
         DrawTextCentered(tip, cardX + cardW / 2, cardY + cardH - 40, 18, DARKGRAY);
 
+        const string& note = settingsMessage.empty() ? netStatus : settingsMessage;
+        if (!note.empty()) {
+            UiBox footer = layout.Box(UiRect::FOOTER_LEFT);
+            DrawTextCentered(note, cardX + cardW / 2, footer.y + footer.h / 2 - 10, 20, MAROON);
+        }
+
     }
 
     // ============================================================
@@ -778,86 +1706,71 @@ private:
     // ============================================================
 
     void UpdateSoundSettings() {
-        // Navigate fields with UP/DOWN (0..1) - NO SOUND
-        if (IsKeyPressed(KEY_UP)) {
-            soundSettingsFieldIndex--;
-            if (soundSettingsFieldIndex < 0) soundSettingsFieldIndex = 1;
-        }
-        if (IsKeyPressed(KEY_DOWN)) {
-            soundSettingsFieldIndex++;
-            if (soundSettingsFieldIndex > 1) soundSettingsFieldIndex = 0;
-        }
-        
-        // Left/right/ENTER to toggle - NO SOUND
-        if (soundSettingsFieldIndex == 0) { // soundEnabled
-            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_ENTER)) {
-                soundEnabled = !soundEnabled;
-            }
-        } else if (soundSettingsFieldIndex == 1) { // musicEnabled
-            if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_ENTER)) {
-                musicEnabled = !musicEnabled;
-            }
-        }
-
         // Geometry for card + buttons
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
+        const Rectangle& backBtn = layout[UiRect::FOOTER_CENTER];
 
-        Rectangle backBtn  = { (float)(cardX + cardW / 2 - btnW / 2), (float)btnY, (float)btnW, (float)btnH };
+        for (const InputEvent& ev : input) {
+            switch (ev.kind) {
+                // Navigate fields with UP/DOWN (0..1) - NO SOUND
+                case InputKind::NAV_UP:
+                    soundSettingsFieldIndex--;
+                    if (soundSettingsFieldIndex < 0) soundSettingsFieldIndex = 1;
+                    break;
+                case InputKind::NAV_DOWN:
+                    soundSettingsFieldIndex++;
+                    if (soundSettingsFieldIndex > 1) soundSettingsFieldIndex = 0;
+                    break;
 
-        Vector2 mouse = GetMousePosition();
+                // Left/right/ENTER to toggle - NO SOUND
+                case InputKind::NAV_LEFT:
+                case InputKind::NAV_RIGHT:
+                case InputKind::CONFIRM:
+                    if (soundSettingsFieldIndex == 0) soundEnabled = !soundEnabled;
+                    else                              musicEnabled = !musicEnabled;
+                    break;
+
+                // Mouse selection of fields + buttons
+                case InputKind::CLICK: {
+                    // Click on fields (NO SOUND)
+                    int xValue = cardX + 550;
+                    int yStart = cardY + 120;
+                    int dy = 60;
+
+                    for (int i = 0; i <= 1; i++) {
+                        int y = yStart + i * dy;
+                        Rectangle box = { (float)(xValue - 10), (float)(y - 5), 320.0f, 36.0f };
+                        if (CheckCollisionPointRec(ev.pos, box)) {
+                            soundSettingsFieldIndex = i;
+                            if (i == 0) soundEnabled = !soundEnabled;
+                            if (i == 1) musicEnabled = !musicEnabled;
+                        }
+                    }
 
-        // Mouse selection of fields + buttons
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            // Click on fields (NO SOUND)
-            int xValue = cardX + 550;
-            int yStart = cardY + 120;
-            int dy = 60;
-
-            for (int i = 0; i <= 1; i++) {
-                int y = yStart + i * dy;
-                Rectangle box = { (float)(xValue - 10), (float)(y - 5), 320.0f, 36.0f };
-                if (CheckCollisionPointRec(mouse, box)) {
-                    soundSettingsFieldIndex = i;
-                    if (i == 0) soundEnabled = !soundEnabled;
-                    if (i == 1) musicEnabled = !musicEnabled;
+                    // Click on BACK button (SOUND)
+                    if (CheckCollisionPointRec(ev.pos, backBtn)) {
+                        PlayClick();
+                        currentScreen = GameScreen::START;
+                        return;
+                    }
+                    break;
                 }
-            }
 
-            // Click on BACK button (SOUND)
-            if (CheckCollisionPointRec(mouse, backBtn)) {
-                PlayClick();
-                currentScreen = GameScreen::START;
-                return;
-            }
-        }
+                // ESC from settings: back to START screen (SOUND)
+                case InputKind::CANCEL:
+                    PlayClick();
+                    currentScreen = GameScreen::START;
+                    return;
 
-        // ESC from settings: back to START screen (SOUND)
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            PlayClick();
-            currentScreen = GameScreen::START;
+                default:
+                    break;
+            }
         }
     }
 
     void DrawSoundSettings() {
-        ClearBackground(BG_COLOR);
-
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
         // Title
         DrawTextSmooth("SOUND SETTINGS", cardX + 340, cardY + 30, 32, BLACK, 2.0f);
@@ -896,11 +1809,7 @@ private:
 
 
         // Button at bottom: BACK
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-
-        Rectangle backBtn  = { (float)(cardX + cardW / 2 - btnW / 2), (float)btnY, (float)btnW, (float)btnH };
+        const Rectangle& backBtn = layout[UiRect::FOOTER_CENTER];
 
         Vector2 mouse = GetMousePosition();
 
@@ -916,88 +1825,86 @@ private:
     // ============================================================
 
     void UpdateLeaderboard() {
-        // Geometry for card + buttons
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-
-        Rectangle backBtn  = { (float)(cardX + cardW / 2 - btnW / 2), (float)btnY, (float)btnW, (float)btnH };
-        Vector2 mouse = GetMousePosition();
+        const Rectangle& backBtn = layout[UiRect::FOOTER_CENTER];
 
-        // Handle BACK button click (SOUND)
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) && CheckCollisionPointRec(mouse, backBtn)) {
-            PlayClick();
-            currentScreen = GameScreen::START;
-            return;
-        }
+        for (const InputEvent& ev : input) {
+            // LEFT/RIGHT page through the rankings (NO SOUND)
+            if (ev.kind == InputKind::NAV_LEFT && leaderboardPage > 0) {
+                leaderboardPage--;
+            }
+            if (ev.kind == InputKind::NAV_RIGHT && leaderboardPage + 1 < LeaderboardPageCount()) {
+                leaderboardPage++;
+            }
 
-        // Return to start screen on ESC or ENTER (SOUND)
-        if (IsKeyPressed(KEY_ESCAPE) || IsKeyPressed(KEY_ENTER)) {
-            PlayClick();
-            currentScreen = GameScreen::START;
+            // BACK button, ESC or ENTER return to start screen (SOUND)
+            bool clickBack = (ev.kind == InputKind::CLICK) && CheckCollisionPointRec(ev.pos, backBtn);
+            if (clickBack || ev.kind == InputKind::CANCEL || ev.kind == InputKind::CONFIRM) {
+                PlayClick();
+                currentScreen = GameScreen::START;
+                return;
+            }
         }
     }
 
     void DrawLeaderboard() {
-        ClearBackground(BG_COLOR);
-
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
         
         DrawTextCentered("LEADERBOARD", screenWidth / 2, cardY + 40, 40, MAROON, 2.5f);
         
-        DrawTextCentered("Top 3 Scores", screenWidth / 2, cardY + 100, 24, BLACK, 2.0f);
+        if (leaderboardPage >= LeaderboardPageCount()) leaderboardPage = LeaderboardPageCount() - 1;
+
+        // Page contents only change with the page or the store
+        if (leaderboardRowsPage != leaderboardPage || leaderboardRowsVersion != leaderboard.Version()) {
+            leaderboard.Page((size_t)leaderboardPage * LEADERBOARD_PAGE_SIZE, LEADERBOARD_PAGE_SIZE, leaderboardRows);
+            leaderboardRowsPage = leaderboardPage;
+            leaderboardRowsVersion = leaderboard.Version();
+        }
+
+        if (leaderboardPageLabel.Changed(leaderboardPage, LeaderboardPageCount())) {
+            leaderboardPageLabel.Format("Top Scores - page %d of %d", leaderboardPage + 1, LeaderboardPageCount());
+        }
+        DrawTextCentered(leaderboardPageLabel.text, screenWidth / 2, cardY + 100, 24, BLACK, 2.0f);
         
         int yStart = cardY + 180;
         int dy = 50;
         
-        if (leaderboard.empty()) {
+        if (leaderboardRows.empty()) {
             DrawTextCentered("No scores recorded yet!", screenWidth / 2, yStart, 22, DARKGRAY, 1.5f);
         } else {
-            for (size_t i = 0; i < leaderboard.size(); ++i) {
-                const PlayerScore& entry = leaderboard[i];
-                string rankStr = "#" + std::to_string(i + 1);
-                string scoreStr = std::to_string(entry.score) + " pts";
+            for (size_t i = 0; i < leaderboardRows.size(); ++i) {
+                const LeaderboardStore::Entry& entry = leaderboardRows[i];
+                size_t rank = (size_t)leaderboardPage * LEADERBOARD_PAGE_SIZE + i;
+
+                char rankStr[16];
+                char scoreStr[32];
+                std::snprintf(rankStr, sizeof(rankStr), "#%zu", rank + 1);
+                std::snprintf(scoreStr, sizeof(scoreStr), "%lld pts", (long long)entry.totalScore);
                 
                 Color rankColor = RAYWHITE;
                 // Assign metal colors for the top 3 ranks
-                if (i == 0) rankColor = GOLD;
-                else if (i == 1) rankColor = LIGHTGRAY; // Silver-ish
-                else if (i == 2) rankColor = BROWN; // Bronze-ish
+                if (rank == 0) rankColor = GOLD;
+                else if (rank == 1) rankColor = LIGHTGRAY; // Silver-ish
+                else if (rank == 2) rankColor = BROWN; // Bronze-ish
 
                 // Draw Rank Box (Centered)
                 int xRank = screenWidth / 2 - 200;
-                DrawRectangle(xRank - 10, yStart + i * dy - 5, 420, 36, LIGHTGRAY);
-                DrawRectangleLines(xRank - 10, yStart + i * dy - 5, 420, 36, DARKGRAY);
+                int y = yStart + (int)i * dy;
+                DrawRectangle(xRank - 10, y - 5, 420, 36, LIGHTGRAY);
+                DrawRectangleLines(xRank - 10, y - 5, 420, 36, DARKGRAY);
 
-                DrawTextSmooth(rankStr.c_str(), xRank, yStart + i * dy, 24, rankColor, 1.5f);
-                DrawTextSmooth(entry.name.c_str(), xRank + 80, yStart + i * dy, 24, BLACK, 1.5f);
-                DrawTextSmooth(scoreStr.c_str(), xRank + 300, yStart + i * dy, 24, MAROON, 1.5f);
+                DrawTextSmooth(rankStr, xRank, y, 24, rankColor, 1.5f);
+                DrawTextSmooth(entry.name, xRank + 80, y, 24, BLACK, 1.5f);
+                DrawTextSmooth(scoreStr, xRank + 300, y, 24, MAROON, 1.5f);
             }
         }
 
         // --- BACK BUTTON ---
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-        Rectangle backBtn  = { (float)(cardX + cardW / 2 - btnW / 2), (float)btnY, (float)btnW, (float)btnH };
+        const Rectangle& backBtn = layout[UiRect::FOOTER_CENTER];
         Vector2 mouse = GetMousePosition();
 
         DrawButton(backBtn,  "BACK TO START", true, CheckCollisionPointRec(mouse, backBtn));
 
-        DrawTextCentered("Press ENTER or ESC to return to Start Screen.", 
+        DrawTextCentered("LEFT/RIGHT to change page. ENTER or ESC to return to Start Screen.", 
                          screenWidth / 2, cardY + cardH - 40, 20, DARKGRAY);
     }
 
@@ -1007,160 +1914,156 @@ private:
     // ============================================================
 
     void UpdateEnterWord() {
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            PlayClick();
-            currentScreen = GameScreen::SETTINGS;
-            return;
-        }
-
-        // Character input: (TYPING AND BACKSPACE - NO SOUND)
-        int ch = GetCharPressed();
-        while (ch > 0) {
-            char c = (char)ch;
-            if (inputStep == 0) 
-            {
-                // allow letters + space in secret word
-                if ((std::isalpha((unsigned char)c) || c == ' ') && inputWord.size() < 20) {
-                    inputWord.push_back(c);
-                }
-            }
-
-            else {
-                if (inputHint.size() < 40 && c >= 32 && c <= 126) {
-                    inputHint.push_back(c);
-                }
-            }
-            ch = GetCharPressed();
-        }
+        // Inputs and buttons
+        const Rectangle& wordBox = layout[UiRect::WORD_BOX];
+        const Rectangle& hintBox = layout[UiRect::HINT_BOX];
 
-        if (IsKeyPressed(KEY_BACKSPACE)) {
-            if (inputStep == 0 && !inputWord.empty()) {
-                inputWord.pop_back();
-            }
-            else if (inputStep == 1 && !inputHint.empty()) {
-                inputHint.pop_back();
-            }
-        }
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& nextBtn = layout[UiRect::FOOTER_RIGHT];
 
-        // Geometry for card, inputs, and buttons
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
+        // Networked: the word may come from the other machine
+        if (net.Active() && TakeRemoteWord()) return;
+        bool canType = LocalIsSetter() && !wordSent;
 
-        int xValue = cardX + 280;
+        for (const InputEvent& ev : input) {
+            bool triggerEnter = false;
 
-        Rectangle wordBox = { (float)(xValue - 10), (float)(cardY + 115), 360.0f, 40.0f };
-        Rectangle hintBox = { (float)(xValue - 10), (float)(cardY + 185), 480.0f, 40.0f };
+            if (!canType && ev.kind != InputKind::CANCEL && ev.kind != InputKind::CLICK) continue;
 
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
+            switch (ev.kind) {
+                case InputKind::CANCEL:
+                    PlayClick();
+                    LeaveToSettings();
+                    return;
 
-        Rectangle backBtn  = { (float)(cardX + 80), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle nextBtn  = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
+                // Character input: (TYPING AND BACKSPACE - NO SOUND)
+                case InputKind::LETTER:
+                case InputKind::TEXT: {
+                    uint32_t c = (uint32_t)ev.codepoint;
+                    if (inputStep == 0)
+                    {
+                        // allow letters of the series' alphabet + space in secret word
+                        bool letter = match.GetAlphabet().IndexOf(c) >= 0;
+                        if ((letter || c == ' ') && Utf8Length(inputWord) < WORD_MAX_CHARS) {
+                            Utf8Append(inputWord, c);
+                        }
+                    }
+                    else {
+                        // any printable character (no C0/C1 controls)
+                        bool printable = c >= 32 && !(c >= 0x7F && c < 0xA0);
+                        if (printable && Utf8Length(inputHint) < HINT_MAX_CHARS) {
+                            Utf8Append(inputHint, c);
+                        }
+                    }
+                    break;
+                }
+                case InputKind::BACKSPACE:
+                    if (inputStep == 0 && !inputWord.empty()) {
+                        Utf8PopBack(inputWord);
+                    }
+                    else if (inputStep == 1 && !inputHint.empty()) {
+                        Utf8PopBack(inputHint);
+                    }
+                    break;
 
-        Vector2 mouse = GetMousePosition();
+                // Mouse interactions
+                case InputKind::CLICK:
+                    // Click in word/hint boxes to switch step (NO SOUND)
+                    if (CheckCollisionPointRec(ev.pos, wordBox)) {
+                        inputStep = 0;
+                    } else if (CheckCollisionPointRec(ev.pos, hintBox)) {
+                        inputStep = 1;
+                    }
 
-        bool triggerEnter = false;
+                    // Click BACK (SOUND)
+                    if (CheckCollisionPointRec(ev.pos, backBtn)) {
+                        PlayClick();
+                        LeaveToSettings();
+                        return;
+                    }
 
-        // Mouse interactions
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            // Click in word/hint boxes to switch step (NO SOUND)
-            if (CheckCollisionPointRec(mouse, wordBox)) {
-                inputStep = 0;
-            } else if (CheckCollisionPointRec(mouse, hintBox)) {
-                inputStep = 1;
-            }
+                    // Click NEXT / START (SOUND)
+                    if (canType && CheckCollisionPointRec(ev.pos, nextBtn)) {
+                        PlayClick();
+                        triggerEnter = true;
+                    }
+                    break;
 
-            // Click BACK (SOUND)
-            if (CheckCollisionPointRec(mouse, backBtn)) {
-                PlayClick();
-                currentScreen = GameScreen::SETTINGS;
-                return;
-            }
+                // Keyboard ENTER
+                case InputKind::CONFIRM:
+                    triggerEnter = true;
+                    break;
 
-            // Click NEXT / START (SOUND)
-            if (CheckCollisionPointRec(mouse, nextBtn)) {
-                PlayClick();
-                triggerEnter = true;
+                default:
+                    break;
             }
-        }
-
-        // Keyboard ENTER
-        if (IsKeyPressed(KEY_ENTER)) {
-            triggerEnter = true;
-        }
 
-        if (triggerEnter) {
-            inputErrorMsg.clear();
+            if (triggerEnter) {
+                inputErrorMsg.clear();
 
-            if (inputStep == 0) {
-                if (!WordValid(inputWord)) {
-                    inputErrorMsg = "Word must contain at least one letter!";
-                } else {
-                    inputStep = 1;
-                }
-            } else {
-                if (inputHint.empty()) {
-                    inputErrorMsg = "Hint cannot be empty!";
+                if (inputStep == 0) {
+                    if (!WordValid(inputWord, match.settings.alphabet)) {
+                        inputErrorMsg = "Word must contain at least one letter!";
+                    } else {
+                        inputStep = 1;
+                    }
                 } else {
-                    secretWord = inputWord;
-                    hint = inputHint;
-                    shownWord = secretWord;
-
-                    // Mask all non-space characters
-                    for (size_t i = 0; i < shownWord.size(); ++i) {
-                         if (std::isalpha((unsigned char)shownWord[i]))
-                            shownWord[i] = '*';
+                    if (inputHint.empty()) {
+                        inputErrorMsg = "Hint cannot be empty!";
+                    } else if (IsJoiner()) {
+                        // The host runs the round and answers with ROUND_START
+                        NetMessage m;
+                        m.type = NetMsg::SET_WORD;
+                        m.text = inputWord;
+                        m.text2 = inputHint;
+                        net.Send(m);
+                        wordSent = true;
+                        return;
+                    } else {
+                        match.StartRound(inputWord, inputHint);
+                        if (net.Active()) SendRoundStart();
+
+                        currentScreen = GameScreen::PLAYING;
+                        return;
                     }
-                    
-                    triedLetters.clear();
-                    lives = 0;
-                    gameOver = false;
-                    win = false;
-                    timeLeft = (float)timeLimitSeconds;
-
-                    currentScreen = GameScreen::PLAYING;
                 }
             }
         }
     }
 
     void DrawEnterWord() {
-        ClearBackground(BG_COLOR);
-
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
-
-        string title = "WORD ENTRY - " + SetterName();
+        string title = "WORD ENTRY - ";
+        title += SetterName();
         DrawTextSmooth(title, cardX + 40, cardY + 30, 30, BLACK, 2.0f);
 
-        string roundStr = "ROUND " + std::to_string(currentRound) +
-                          " OF " + std::to_string(totalRounds);
+        string roundStr = "ROUND " + std::to_string(match.currentRound) +
+                          " OF " + std::to_string(match.settings.totalRounds);
         DrawTextSmooth(roundStr.c_str(), cardX + cardW - 260, cardY + 35, 22, DARKGRAY, 2.0f);
 
+        // Networked guesser (or a joiner that already sent its word) just waits
+        if (!LocalIsSetter() || wordSent) {
+            string waiting = wordSent ? string("Word sent. Waiting for the host...")
+                                      : string(SetterName()) + " is choosing a word...";
+            DrawTextCentered(waiting, cardX + cardW / 2, cardY + cardH / 2 - 20, 28, DARKGRAY, 2.0f);
+            DrawTextCentered("ESC leaves the match.", cardX + cardW / 2, cardY + cardH - 40, 18, DARKGRAY);
+            return;
+        }
+
         int xLabel = cardX + 60;
         int xValue = cardX + 280;
 
         DrawTextSmooth("SECRET WORD:", xLabel, cardY + 120, 24, BLACK, 2.0f);
         if (inputStep == 0) {
             DrawRectangleLinesEx(
-                { (float)(xValue - 10), (float)(cardY + 115), 360, 40 },
+                layout[UiRect::WORD_BOX],
                 3.0f,
                 MAROON
             );
         } else {
             DrawRectangleLinesEx(
-                { (float)(xValue - 10), (float)(cardY + 115), 360, 40 },
+                layout[UiRect::WORD_BOX],
                 2.0f,
                 DARKGRAY
             );
@@ -1170,13 +2073,13 @@ private:
         DrawTextSmooth("HINT:", xLabel, cardY + 190, 24, BLACK, 2.0f);
         if (inputStep == 1) {
             DrawRectangleLinesEx(
-                { (float)(xValue - 10), (float)(cardY + 185), 480, 40 },
+                layout[UiRect::HINT_BOX],
                 3.0f,
                 MAROON
             );
         } else {
             DrawRectangleLinesEx(
-                { (float)(xValue - 10), (float)(cardY + 185), 480, 40 },
+                layout[UiRect::HINT_BOX],
                 2.0f,
                 DARKGRAY
             );
@@ -1188,12 +2091,8 @@ private:
             DrawTextSmooth(inputErrorMsg.c_str(), xLabel, cardY + 250, 22, RED);
 
         // Buttons at bottom: BACK and NEXT/START
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-
-        Rectangle backBtn  = { (float)(cardX + 80), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle nextBtn  = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& nextBtn = layout[UiRect::FOOTER_RIGHT];
 
         Vector2 mouse = GetMousePosition();
 
@@ -1210,34 +2109,10 @@ private:
     // ============================================================
 
     void UpdatePlaying() {
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            PlayClick();
-            currentScreen = GameScreen::SETTINGS;
-            return;
-        }
-
-        // Geometry (used for mouse-button 'Next' and keyboard clicks)
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        int sidebarW = 220;
-        int mainX = cardX + sidebarW + 30;
-        int mainY = cardY + 20;
-        int mainW = cardW - sidebarW - 50;
-
-        int kbStartX = mainX + 40;
-        int kbStartY = mainY + 60 + 80;  // wordY = mainY + 60, then +80
+        // Mouse-button 'Next'; the on-screen keyboard hit-tests itself
+        const Rectangle& nextBtn = layout[UiRect::FOOTER_RIGHT];
 
-        int btnW = 200;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-        Rectangle nextBtn = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
-        Vector2 mouse = GetMousePosition();
-
-        float dt = GetFrameTime();
+        float dt = clock.Delta();
 
         // update animation timers
         if (wrongShakeTimer > 0.0f) {
@@ -1249,197 +2124,178 @@ private:
             if (winJumpTimer < 0.0f) winJumpTimer = 0.0f;
         }
 
-        if (!gameOver) {
-            timeLeft -= dt;
-            if (timeLeft <= 0.0f) {
-                timeLeft = 0.0f;
-                gameOver = true;
-                win = false;
-                AwardScore(false);
+        if (IsJoiner()) {
+            // Host owns the clock: count down locally between TIMER_SYNCs
+            if (!match.gameOver) {
+                match.timeLeft -= dt;
+                if (match.timeLeft < 0.0f) match.timeLeft = 0.0f;
+            }
+            TakeRoundMessages();
+        } else {
+            if (match.Tick(dt)) {
+                if (net.Active()) SendRoundEnd();
                 return;
             }
+            if (net.Active()) {
+                if (!match.gameOver) SendTimerSync();
+                TakeRoundMessages();
+            }
+        }
 
-            // Keyboard input
-            HandleGuessInput();
+        // Computer guesser: one guess per AI_GUESS_DELAY so it can be followed
+        if (rival == RivalMode::COMPUTER_GUESSER && !match.gameOver) {
+            aiGuessTimer -= dt;
+            if (aiGuessTimer <= 0.0f) {
+                aiGuessTimer = AI_GUESS_DELAY;
+                char guess = solver.NextGuess(match.shownWord, (uint32_t)match.letters.triedMask);
+                if (guess != 0) ProcessGuess(guess);
+            }
+        }
 
-            // Mouse clicking on on-screen keyboard
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                int boxSize = 40;
-                int boxGap  = 10;
-                int kbCols  = 7;
-
-                for (int i = 0; i < 26; ++i) {
-                    int row = i / kbCols;
-                    int col = i % kbCols;
-                    int bx = kbStartX + col * (boxSize + boxGap);
-                    int by = kbStartY + row * (boxSize + boxGap);
-
-                    Rectangle keyBox = { (float)bx, (float)by, (float)boxSize, (float)boxSize };
-                    if (CheckCollisionPointRec(mouse, keyBox)) {
-                        char letter = 'A' + i;
-                        if (triedLetters.find(letter) == string::npos) {
-                            triedLetters.push_back(letter);
-                            ProcessGuess(letter);
-                            // PlayClick(); // Removed: No sound for guesses
-                        }
-                        break;
-                    }
-                }
+        for (const InputEvent& ev : input) {
+            if (ev.kind == InputKind::CANCEL) {
+                PlayClick();
+                LeaveToSettings();
+                return;
             }
-        } else {
-            // gameOver = true: allow ENTER or clicking NEXT button (SOUND)
-            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-                if (CheckCollisionPointRec(mouse, nextBtn)) {
+
+            if (!match.gameOver) {
+                // Typed or clicked letters (NO SOUND for guesses)
+                if (rival != RivalMode::COMPUTER_GUESSER && LocalIsGuesser()) HandleGuessInput(ev);
+            } else {
+                // gameOver = true: allow ENTER or clicking NEXT button (SOUND)
+                bool clickNext = (ev.kind == InputKind::CLICK) && CheckCollisionPointRec(ev.pos, nextBtn);
+                if (clickNext || ev.kind == InputKind::CONFIRM) {
                     PlayClick();
                     AdvanceRoundOrSummary();
                     return;
                 }
             }
-
-            if (IsKeyPressed(KEY_ENTER)) {
-                PlayClick();
-                AdvanceRoundOrSummary();
-            }
         }
     }
 
     void AdvanceRoundOrSummary() {
-        if (currentRound < totalRounds) {
-            currentRound++;
-            SwapRoles();
+        if (match.AdvanceRound()) {
             ResetRoundState();
             ResetWordInput();
-            currentScreen = GameScreen::ENTER_WORD;
+            BeginRoundSetup();
         } else {
             currentScreen = GameScreen::SUMMARY;
         }
     }
 
     void DrawPlaying() {
-        ClearBackground(BG_COLOR);
-
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
-
-        // ---- Left sidebar: round + scores ----
-        int sidebarW = 220;   // narrower now
-        DrawRectangle(cardX, cardY, sidebarW, cardH, LIGHTGRAY);
-        DrawRectangleLines(cardX, cardY, sidebarW, cardH, BLACK);
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
-        // Header bar
-        DrawRectangle(cardX, cardY, sidebarW, 40, BLACK);
-        string puzzleHeader = "ROUND " + std::to_string(currentRound) +
-                              " OF " + std::to_string(totalRounds);
-        DrawTextSmooth(puzzleHeader.c_str(), cardX + 10, cardY + 10, 20, RAYWHITE, 2.0f);
+        // ---- Left sidebar: round + scores (its panel is in the screen layer) ----
+        if (puzzleHeaderLabel.Changed(match.currentRound, match.settings.totalRounds)) {
+            puzzleHeaderLabel.Format("ROUND %d OF %d", match.currentRound, match.settings.totalRounds);
+        }
+        DrawTextSmooth(puzzleHeaderLabel.text, cardX + 10, cardY + 10, 20, RAYWHITE, 2.0f);
 
         // Player rows
         int rowY = cardY + 60;
         int rowH = 70;
 
-        auto drawPlayerRow = [&](const string& name, int score, bool isGuesser) {
+        auto drawPlayerRow = [&](const NameString& name, int score, bool isGuesser, CachedLabel& scoreLabel) {
             Color nameColor = isGuesser ? BLACK : DARKGRAY;
             DrawTextSmooth(name.c_str(), cardX + 16, rowY, 22, nameColor, 1.8f);
 
-            string scoreStr = std::to_string(score) + " pts";
-            DrawTextSmooth(scoreStr.c_str(), cardX + 16, rowY + 26, 18, nameColor);
+            if (scoreLabel.Changed(score)) {
+                scoreLabel.Format("%d pts", score);
+            }
+            DrawTextSmooth(scoreLabel.text, cardX + 16, rowY + 26, 18, nameColor);
 
             rowY += rowH;
         };
 
-        bool p1Guesser = !player1IsSetter;
-        drawPlayerRow(player1Name, player1Score, p1Guesser);
-        drawPlayerRow(player2Name, player2Score, !p1Guesser);
+        bool p1Guesser = !match.player1IsSetter;
+        drawPlayerRow(player1Name, match.player1Score, p1Guesser, scoreLabels[0]);
+        drawPlayerRow(player2Name, match.player2Score, !p1Guesser, scoreLabels[1]);
+
+        if (net.Active()) {
+            int rtt = net.RttMs();
+            if (pingLabel.Changed(rtt, (int)net.Connected())) {
+                if (!net.Connected()) pingLabel.Format("OFFLINE");
+                else if (rtt < 0)     pingLabel.Format("PING: -- ms");
+                else                  pingLabel.Format("PING: %d ms", rtt);
+            }
+            DrawTextSmooth(pingLabel.text, cardX + 16, rowY + 10, 18, DARKGRAY);
+        }
 
         // ---- Right main play area ----
-        int mainX = cardX + sidebarW + 30;
-        int mainY = cardY + 20;
-        int mainW = cardW - sidebarW - 50;
-        int mainH = cardH - 40;
+        auto [mainX, mainY, mainW, mainH] = layout.Box(UiRect::PLAY_MAIN);
 
         // Top title (hint or default)
-        string title = hint.empty() ? "HANGMAN" : ("HINT: " + hint);
+        if (titleLabel.Changed(match.roundSerial)) {
+            if (match.hint.empty()) titleLabel.Format("HANGMAN");
+            else                    titleLabel.Format("HINT: %s", match.hint.c_str());
+        }
         float titleSize = 30.0f;
         float titleSpacing = 2.0f;
-        Vector2 titleMeasure = MeasureTextEx(uiFont, title.c_str(), titleSize, titleSpacing);
+        Vector2 titleMeasure = textCache.Measure(titleLabel.text, titleSize, titleSpacing);
         int titleX = mainX + (mainW - (int)titleMeasure.x) / 2;
-        DrawTextEx(uiFont, title.c_str(),
-                   Vector2{ (float)titleX, (float)mainY }, titleSize, titleSpacing, BLACK);
+        fonts.Queue(titleLabel.text, Vector2{ (float)titleX, (float)mainY }, titleSize, titleSpacing, BLACK);
 
-        // Word display
-        string spacedWord = SpacedWord(shownWord);
+        // Word display (hidden-letter count changes on every hit)
+        if (wordLabel.Changed(match.roundSerial, match.letters.hiddenCount)) {
+            SpacedWord(match.shownWord, wordLabel.text, CachedLabel::CAPACITY);
+        }
         float wordSize = 36.0f;
         float wordSpacing = 6.0f;
-        Vector2 wordMeasure = MeasureTextEx(uiFont, spacedWord.c_str(),
+        Vector2 wordMeasure = textCache.Measure(wordLabel.text,
                                             wordSize, wordSpacing);
         int wordX = mainX + (mainW - (int)wordMeasure.x) / 2;
         int wordY = mainY + 60;
-        DrawTextEx(uiFont, spacedWord.c_str(),
-                   Vector2{ (float)wordX, (float)wordY }, wordSize, wordSpacing, BLACK);
-
-        // Keyboard grid A-Z (visual)
-        int kbStartX = mainX + 40;
-        int kbStartY = wordY + 80;
-        int boxSize = 40;
-        int boxGap = 10;
-        int kbCols = 7;  // more columns now for better width use
-
-        for (int i = 0; i < 26; ++i) {
-            int row = i / kbCols;
-            int col = i % kbCols;
-            int bx = kbStartX + col * (boxSize + boxGap);
-            int by = kbStartY + row * (boxSize + boxGap);
-
-            char letter = 'A' + i;
-            bool used = (triedLetters.find(letter) != string::npos);
-
-            if (used) {
-                DrawRectangle(bx, by, boxSize, boxSize, LIGHTGRAY);
-            }
-            DrawRectangleLines(bx, by, boxSize, boxSize, BLACK);
+        fonts.Queue(wordLabel.text, Vector2{ (float)wordX, (float)wordY }, wordSize, wordSpacing, BLACK);
 
-            char txt[2] = { letter, '\0' };
-            DrawTextSmooth(txt, bx + 13, by + 9, 22, BLACK, 1.5f);
+        // Keyboard grid of the alphabet (visual): one batched draw from the key atlas
+        auto [kbStartX, kbStartY, kbW, kbH] = layout.Box(UiRect::KEYBOARD);
+        {
+            ProfileScope keyboardTiming(profiler, ProfileSection::KEYBOARD);
+            keyboard.Draw(match.letters.triedMask);
+            profiler.CountDraws(1); // one textured quad batch
         }
 
-        int infoY = kbStartY + 4 * (boxSize + boxGap) + 8;
-        string livesStr = "Wrong guesses: " + std::to_string(lives) +
-                          "/" + std::to_string(maxLivesSetting);
-        DrawTextSmooth(livesStr.c_str(), kbStartX, infoY, 20, BLACK);
+        int infoY = keyboard.Bottom() + 8;
+        if (livesLabel.Changed(match.lives, match.settings.maxLivesSetting)) {
+            livesLabel.Format("Wrong guesses: %d/%d", match.lives, match.settings.maxLivesSetting);
+        }
+        DrawTextSmooth(livesLabel.text, kbStartX, infoY, 20, BLACK);
 
-        string timeStr = "Time left: " + std::to_string((int)timeLeft) + " s";
-        DrawTextSmooth(timeStr.c_str(), kbStartX, infoY + 24, 20, BLACK);
+        int secondsLeft = (int)match.timeLeft;
+        if (timeLabel.Changed(secondsLeft)) {
+            timeLabel.Format("Time left: %d s", secondsLeft);
+        }
+        DrawTextSmooth(timeLabel.text, kbStartX, infoY + 24, 20, BLACK);
 
         Vector2 mouse = GetMousePosition();
 
         // Game over / instructions at bottom
         int bottomY = cardY + cardH - 45;
-        if (!gameOver) {
-            DrawTextSmooth("Type A-Z or click letters to guess. ESC = settings.",
-                           kbStartX, bottomY, 18, DARKGRAY);
+        if (!match.gameOver) {
+            const char* help = LocalIsGuesser()
+                ? "Type or click letters to guess. ESC = settings."
+                : "Your rival is guessing. ESC = settings.";
+            DrawTextSmooth(help, kbStartX, bottomY, 18, DARKGRAY);
         } else {
-            if (win) {
-                string winMsg = "YOU WIN, " + GuesserName() + "!";
-                DrawTextSmooth(winMsg.c_str(), kbStartX, bottomY - 70, 24, GREEN, 2.0f);
+            if (resultLabel.Changed(match.roundSerial, match.win, namesVersion)) {
+                const char* guesser = match.player1IsSetter ? player2Name.c_str() : player1Name.c_str();
+                resultLabel.Format(match.win ? "YOU WIN, %s!" : "YOU LOSE, %s!", guesser);
+            }
+            if (match.win) {
+                DrawTextSmooth(resultLabel.text, kbStartX, bottomY - 70, 24, GREEN, 2.0f);
             } else {
-                string loseMsg = "YOU LOSE, " + GuesserName() + "!";
-                DrawTextSmooth(loseMsg.c_str(), kbStartX, bottomY - 70, 24, RED, 2.0f);
+                DrawTextSmooth(resultLabel.text, kbStartX, bottomY - 70, 24, RED, 2.0f);
 
-                string wordMsg = "Word was: " + secretWord;
-                DrawTextSmooth(wordMsg.c_str(), kbStartX, bottomY - 45, 20, DARKGRAY);
+                if (wordWasLabel.Changed(match.roundSerial)) {
+                    wordWasLabel.Format("Word was: %s", match.secretWord.c_str());
+                }
+                DrawTextSmooth(wordWasLabel.text, kbStartX, bottomY - 45, 20, DARKGRAY);
             }
 
             // NEXT button (for next round or summary)
-            int btnW = 200;
-            int btnH = 50;
-            int btnY = cardY + cardH - 130;
-            Rectangle nextBtn = { (float)(cardX + cardW - 80 - btnW), (float)btnY, (float)btnW, (float)btnH };
+            const Rectangle& nextBtn = layout[UiRect::FOOTER_RIGHT];
 
             DrawButton(nextBtn, "NEXT", true, CheckCollisionPointRec(mouse, nextBtn));
 
@@ -1450,246 +2306,326 @@ private:
         int hangmanX = mainX + mainW - 220;
         int hangmanY = kbStartY + 10;
 
-        DrawHangman(hangmanX, hangmanY);              // main hangman
+        int stage = match.lives > 7 ? 7 : match.lives;
+        DrawHangman(hangmanX, hangmanY, stage, HangmanAnimationOffset());
     }
 
-    void HandleGuessInput() {
-        // Handle individual key presses A-Z (NO SOUND)
-        for (int key = KEY_A; key <= KEY_Z; key++) {
-            if (IsKeyPressed(key)) {
-                char ch = 'A' + (key - KEY_A);
-                if (triedLetters.find(ch) == string::npos) {
-                    triedLetters.push_back(ch);
-                    ProcessGuess(ch);
-                }
-            }
-        }
-        
-        // Handle other character inputs (less crucial for click sound here)
-        int c = GetCharPressed();
-        while (c > 0) {
-            // Processing logic...
-            c = GetCharPressed();
+    void HandleGuessInput(const InputEvent& ev) {
+        uint32_t letter = 0;
+        if (ev.kind == InputKind::LETTER) {
+            letter = ev.Letter();
+        } else if (ev.kind == InputKind::CLICK) {
+            // Mouse clicking on on-screen keyboard
+            int i = keyboard.HitTest(ev.pos);
+            if (i >= 0) letter = keyboard.GetAlphabet().Letter(i);
         }
-    }
-
-    void ProcessGuess(char ch) {
-        bool found = false;
-        string upperSecret = Upper(secretWord);
 
-        for (size_t i = 0; i < upperSecret.size(); ++i) 
-        {
-            if (secretWord[i] == ' ') 
-            {
-                shownWord[i] = ' ';        // auto-show space
-                continue;
-            }
-            if (upperSecret[i] == ch) 
-            {
-                shownWord[i] = secretWord[i];
-                found = true;
+        // Letters of another alphabet are not guesses in this series
+        if (letter != 0 && match.GetAlphabet().IndexOf(letter) >= 0 && !match.IsTried(letter)) {
+            if (IsJoiner()) {
+                NetMessage m;
+                m.type = NetMsg::GUESS;
+                m.letter = (uint16_t)letter;
+                net.Send(m); // applied when the host's REVEAL comes back
+            } else {
+                ProcessGuess(letter);
             }
         }
+    }
 
+    // Apply a guess to the rules and kick off the matching animation
+    void ProcessGuess(uint32_t letter) {
+        GuessResult result = match.ProcessGuess(letter);
+        RecordGuess(letter, result);
+
+        // Host: every accepted guess goes out as a reveal delta
+        if (net.Active() && result != GuessResult::ALREADY_TRIED) {
+            NetMessage m;
+            m.type = NetMsg::REVEAL;
+            m.letter = (uint16_t)FoldCase(letter);
+            m.mask = match.PositionMask(letter);
+            m.lives = (uint8_t)match.lives;
+            m.result = (uint8_t)result;
+            net.Send(m);
+            if (match.gameOver) SendRoundEnd();
+        }
+        StartGuessAnimation(result);
+    }
 
-        if (!found) {
-            lives++;
-
+    void StartGuessAnimation(GuessResult result) {
+        if (result == GuessResult::MISS) {
             // start shake animation (if not hanged yet)
-            if (lives < maxLivesSetting) {
-                wrongShakeTimer = 0.35f; // ~0.35 seconds of wiggle
-            }
-            if (lives >= maxLivesSetting) {
-                gameOver = true;
-                win = false;
-                AwardScore(false);
-            }
-        } else {
-            // Check if the word is fully guessed (no remaining '*')
-            bool allGuessed = true;
-            for (char s_char : shownWord) {
-                if (s_char == '*') {
-                    allGuessed = false;
-                    break;
-                }
-            }
-            
-            if (allGuessed) {
-                gameOver = true;
-                win = true;
-                AwardScore(true);
-
-                winJumpTimer = 0.6f; // brief jump animation
-            }
+            wrongShakeTimer = 0.35f; // ~0.35 seconds of wiggle
+        } else if (result == GuessResult::WON) {
+            winJumpTimer = 0.6f; // brief jump animation
         }
     }
 
-    void DrawHangman(int x, int y) {
+    // stage 0..7: gallows only .. full body with X eyes; offset moves the whole figure
+    void DrawHangman(int x, int y, int stage, Vector2 offset = Vector2{ 0, 0 }) {
+        ProfileScope hangmanTiming(profiler, ProfileSection::DRAW_HANGMAN);
+
         // Make him bigger and slightly left/down from anchor
         x -= 40;   // move a bit left
         y += 20;   // move a bit down
 
-        int steps = (lives > 7 ? 7 : lives);
-
-        float T = 7.0f;      // line thickness
-        float S = 1.35f;     // overall scale
+        hangmanMesh.Draw(stage, (float)(x + (int)offset.x), (float)(y + (int)offset.y));
+        profiler.CountDraws(1); // one triangle run
+    }
 
-        // Shake on wrong guess
-        float shakeOffsetX = 0.0f;
+    // Shake on a wrong guess, little vertical bounce on a win
+    Vector2 HangmanAnimationOffset() const {
+        Vector2 offset{ 0, 0 };
         if (wrongShakeTimer > 0.0f) {
-            float t = GetTime() * 40.0f;
+            float t = (float)clock.Now() * 40.0f;
             float amp = 6.0f;
-            shakeOffsetX = sinf(t) * amp * (wrongShakeTimer / 0.35f);
+            offset.x = sinf(t) * amp * (wrongShakeTimer / 0.35f);
         }
-
-        // Jump on win (little vertical bounce)
-        float jumpOffsetY = 0.0f;
-        if (win && winJumpTimer > 0.0f) {
+        if (match.win && winJumpTimer > 0.0f) {
             float t = (0.6f - winJumpTimer) * 10.0f;
             float amp = 14.0f;
-            jumpOffsetY = -sinf(t) * amp * (winJumpTimer / 0.6f);
-        }
-
-        x += (int)shakeOffsetX;
-        y += (int)jumpOffsetY;
-
-        auto P = [&](float v) { return v * S; };
-
-        // ---- Gallows (thick black) ----
-        DrawLineEx(
-            { (float)x,            (float)(y + P(120)) },
-            { (float)(x + P(120)), (float)(y + P(120)) },
-            T, BLACK
-        );
-        DrawLineEx(
-            { (float)(x + P(60)),  (float)(y + P(120)) },
-            { (float)(x + P(60)),  (float)(y - P(40))  },
-            T, BLACK
-        );
-        DrawLineEx(
-            { (float)(x + P(60)),  (float)(y - P(40))  },
-            { (float)(x + P(130)), (float)(y - P(40))  },
-            T, BLACK
-        );
-        DrawLineEx(
-            { (float)(x + P(130)), (float)(y - P(40))  },
-            { (float)(x + P(130)), (float)(y + P(10))  },
-            T, BLACK
-        );
-
-        // rounded ends on the vertical post
-        DrawCircle((int)(x + P(60)), (int)(y - P(40)),  T * 0.6f, BLACK);
-        DrawCircle((int)(x + P(60)), (int)(y + P(120)), T * 0.6f, BLACK);
-
-        // ---- Hangman body ----
-        // Head
-        if (steps >= 1)
-            DrawCircle((int)(x + P(130)), (int)(y + P(10)), P(18), BLACK);
-
-        // Body
-        if (steps >= 2)
-            DrawLineEx(
-                { (float)(x + P(130)), (float)(y + P(25)) },
-                { (float)(x + P(130)), (float)(y + P(60)) },
-                T, BLACK
-            );
-
-        // Left arm
-        if (steps >= 3)
-            DrawLineEx(
-                { (float)(x + P(130)), (float)(y + P(35)) },
-                { (float)(x + P(110)), (float)(y + P(50)) },
-                T, BLACK
-            );
-
-        // Right arm
-        if (steps >= 4)
-            DrawLineEx(
-                { (float)(x + P(130)), (float)(y + P(35)) },
-                { (float)(x + P(150)), (float)(y + P(50)) },
-                T, BLACK
-            );
-
-        // Left leg
-        if (steps >= 5)
-            DrawLineEx(
-                { (float)(x + P(130)), (float)(y + P(60)) },
-                { (float)(x + P(115)), (float)(y + P(85)) },
-                T, BLACK
-            );
-
-        // Right leg
-        if (steps >= 6)
-            DrawLineEx(
-                { (float)(x + P(130)), (float)(y + P(60)) },
-                { (float)(x + P(145)), (float)(y + P(85)) },
-                T, BLACK
-            );
-
-        // X eyes when fully hanged
-        if (steps >= 7) {
-            float ox = P(130);
-            float oy = P(10);
-            DrawLineEx({(float)(x + ox - P(8)), (float)(y + oy - P(5))},
-                       {(float)(x + ox - P(2)), (float)(y + oy + P(5))}, 3, RED);
-            DrawLineEx({(float)(x + ox - P(2)), (float)(y + oy - P(5))},
-                       {(float)(x + ox - P(8)), (float)(y + oy + P(5))}, 3, RED);
-
-            DrawLineEx({(float)(x + ox + P(2)), (float)(y + oy - P(5))},
-                       {(float)(x + ox + P(8)), (float)(y + oy + P(5))}, 3, RED);
-            DrawLineEx({(float)(x + ox + P(8)), (float)(y + oy - P(5))},
-                       {(float)(x + ox + P(2)), (float)(y + oy + P(5))}, 3, RED);
+            offset.y = -sinf(t) * amp * (winJumpTimer / 0.6f);
         }
+        return offset;
     }
 
     // ============================================================
     // SUMMARY SCREEN
     // ============================================================
     void UpdateSummary() {
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        int btnW = 220;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
 
-        Rectangle lobbyBtn = { (float)(cardX + 40), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle quitBtn  = { (float)(cardX + cardW - 40 - btnW), (float)btnY, (float)btnW, (float)btnH };
+        const Rectangle& lobbyBtn = layout[UiRect::SUMMARY_LOBBY];
+        const Rectangle& quitBtn = layout[UiRect::SUMMARY_QUIT];
 
-        Vector2 mouse = GetMousePosition();
+        for (const InputEvent& ev : input) {
+            bool click = (ev.kind == InputKind::CLICK);
 
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            if (CheckCollisionPointRec(mouse, lobbyBtn)) {
+            if ((click && CheckCollisionPointRec(ev.pos, lobbyBtn)) || ev.kind == InputKind::CONFIRM) {
                 PlayClick();
+                if (kiosk.match >= 0) {
+                    int p1 = match.player1Score, p2 = match.player2Score;
+                    tournament.ReportKiosk(kiosk.match, kioskAIsP1 ? p1 : p2, kioskAIsP1 ? p2 : p1);
+                    ResetToLobby();
+                    EndKioskSeries();
+                    return;
+                }
                 UpdateLeaderboardScores();
                 ResetToLobby();
                 return;
             }
-            if (CheckCollisionPointRec(mouse, quitBtn)) {
+            if (click && CheckCollisionPointRec(ev.pos, quitBtn)) {
                 PlayClick();
                 CloseWindow();
                 return;
             }
+            if (ev.kind == InputKind::CANCEL) {
+                CloseWindow();
+                return;
+            }
+        }
+    }
+
+    // ============================================================
+    // TOURNAMENT
+    // ============================================================
+    // Once per frame: finished scores into the leaderboard (one batch), and a
+    // fresh bracket copy when it changed. Both are skipped if the workers
+    // hold the lock at that moment.
+    void PollTournament() {
+        tournament.TakeScores(bracketScores);
+        if (!bracketScores.empty()) {
+            if (!replayed) {
+                vector<std::pair<std::string_view, int>> batch;
+                for (const TournamentScore& sc : bracketScores) {
+                    if (sc.score > 0) batch.emplace_back(sc.name.view(), sc.score);
+                }
+                leaderboard.RecordBatch(batch);
+            }
+            bracketScores.clear();
+        }
+
+        if (!tournament.CopyIfChanged(bracketView)) return;
+
+        const TournamentView& v = bracketView;
+        bracketLabels.assign(v.matches.size() * 2, string());
+        int done = 0, played = 0;
+        for (size_t m = 0; m < v.matches.size(); ++m) {
+            const BracketMatch& bm = v.matches[m];
+            if (bm.bye) continue;
+            played++;
+            if (bm.state == BracketState::DONE) done++;
+            char buf[48];
+            const int sides[2] = { bm.a, bm.b };
+            const int points[2] = { bm.scoreA, bm.scoreB };
+            for (int k = 0; k < 2; ++k) {
+                const char* name = sides[k] >= 0 ? v.players[sides[k]].name.c_str() : "...";
+                if (bm.state == BracketState::DONE) std::snprintf(buf, sizeof(buf), "%-15s %d", name, points[k]);
+                else std::snprintf(buf, sizeof(buf), "%s", name);
+                bracketLabels[m * 2 + k] = buf;
+            }
+        }
+
+        char buf[96];
+        if (v.champion >= 0) {
+            std::snprintf(buf, sizeof(buf), "Champion: %s", v.players[v.champion].name.c_str());
+            if (!championLogged) {
+                TraceLog(LOG_INFO, "TOURNAMENT: %d players, champion %s", (int)v.players.size(),
+                         v.players[v.champion].name.c_str());
+                championLogged = true;
+            }
+        } else {
+            std::snprintf(buf, sizeof(buf), "%d of %d matches played, %d on the computer now", done, played, v.running);
+        }
+        bracketStatus = buf;
+    }
+
+    // First kiosk match whose players are known, from the bracket copy
+    const BracketMatch* NextKioskInView() const {
+        for (const BracketMatch& bm : bracketView.matches) {
+            bool kioskPlayer = bm.a >= 0 && bm.b >= 0 &&
+                               (bracketView.players[bm.a].human || bracketView.players[bm.b].human);
+            if (bm.state == BracketState::READY && kioskPlayer) return &bm;
+        }
+        return nullptr;
+    }
+
+    void StartKioskSeries(const KioskMatch& k) {
+        kiosk = k;
+        kioskSavedP1 = player1Name;
+        kioskSavedP2 = player2Name;
+        kioskSavedRival = rival;
+
+        // Against a computer seat the human is player 1 and guesses every word
+        bool bothHuman = k.a.human && k.b.human;
+        kioskAIsP1 = k.a.human;
+        player1Name = kioskAIsP1 ? k.a.name : k.b.name;
+        player2Name = kioskAIsP1 ? k.b.name : k.a.name;
+        namesVersion++;
+        rival = bothHuman ? RivalMode::HUMAN : RivalMode::COMPUTER_SETTER;
+        BeginSeries();
+    }
+
+    // Back to the bracket with the settings the kiosk series borrowed
+    void EndKioskSeries() {
+        RestoreUserSettings();
+        kiosk.match = -1;
+        player1Name = kioskSavedP1;
+        player2Name = kioskSavedP2;
+        namesVersion++;
+        rival = kioskSavedRival;
+        ResetSettingsInput();
+        currentScreen = GameScreen::TOURNAMENT;
+    }
+
+    void UpdateTournament() {
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& playBtn = layout[UiRect::FOOTER_RIGHT];
+
+        for (const InputEvent& ev : input) {
+            bool click = (ev.kind == InputKind::CLICK);
+
+            if ((click && CheckCollisionPointRec(ev.pos, backBtn)) || ev.kind == InputKind::CANCEL) {
+                PlayClick();
+                currentScreen = GameScreen::START; // the bracket carries on in the background
+                return;
+            }
+
+            bool play = (click && CheckCollisionPointRec(ev.pos, playBtn)) || ev.kind == InputKind::CONFIRM;
+            KioskMatch k;
+            if (play && tournament.KioskWaiting() && tournament.TakeKioskMatch(k)) {
+                PlayClick();
+                StartKioskSeries(k);
+                return;
+            }
+        }
+    }
+
+    void DrawTournament() {
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
+        const TournamentView& v = bracketView;
+
+        DrawTextCentered("TOURNAMENT", screenWidth / 2, cardY + 30, 40, MAROON, 2.5f);
+        DrawTextCentered(bracketStatus, screenWidth / 2, cardY + 82, 22, BLACK, 1.5f);
+
+        // One column per round; rounds with more matches than fit are left out
+        static const int MAX_ROWS = 8;
+        int firstRound = 0;
+        while (firstRound < v.rounds - 1 && (v.field >> (firstRound + 1)) > MAX_ROWS) firstRound++;
+        int columns = v.rounds - firstRound;
+        int areaX = cardX + 40, areaY = cardY + 120;
+        int areaW = cardW - 80, areaH = cardH - 230;
+        int colW = columns > 0 ? areaW / columns : areaW;
+
+        for (int r = firstRound; r < v.rounds; ++r) {
+            int first = v.field - (v.field >> r);
+            int count = v.field >> (r + 1);
+            int slotH = areaH / count;
+            int x = areaX + (r - firstRound) * colW;
+            for (int i = 0; i < count; ++i) {
+                int m = first + i;
+                const BracketMatch& bm = v.matches[m];
+                int y = areaY + i * slotH + slotH / 2 - 22;
+                Color edge = bm.state == BracketState::RUNNING ? MAROON : DARKGRAY;
+                DrawRectangle(x, y, colW - 16, 44, bm.bye ? Fade(LIGHTGRAY, 0.5f) : LIGHTGRAY);
+                DrawRectangleLines(x, y, colW - 16, 44, edge);
+                if (bm.bye) continue;
+                for (int k = 0; k < 2; ++k) {
+                    int side = k == 0 ? bm.a : bm.b;
+                    Color c = (bm.state == BracketState::DONE && side == bm.winner) ? DARKGREEN : BLACK;
+                    DrawTextSmooth(bracketLabels[m * 2 + k], x + 6, y + 3 + k * 20, 18, c);
+                }
+            }
         }
 
-        if (IsKeyPressed(KEY_ENTER)) {
-            PlayClick();
-            UpdateLeaderboardScores();
-            ResetToLobby();
+        // Footer: back to START, or the next match for this machine
+        const Rectangle& backBtn = layout[UiRect::FOOTER_LEFT];
+        const Rectangle& playBtn = layout[UiRect::FOOTER_RIGHT];
+        Vector2 mouse = GetMousePosition();
+        DrawButton(backBtn, "MAIN MENU", false, CheckCollisionPointRec(mouse, backBtn));
+
+        const BracketMatch* next = NextKioskInView();
+        if (next != nullptr) {
+            DrawButton(playBtn, "PLAY MATCH", true, CheckCollisionPointRec(mouse, playBtn));
+            char buf[64];
+            std::snprintf(buf, sizeof(buf), "Next at this kiosk: %s vs %s",
+                          v.players[next->a].name.c_str(), v.players[next->b].name.c_str());
+            DrawTextCentered(buf, screenWidth / 2, cardY + cardH - 40, 20, DARKGRAY);
+        } else {
+            DrawTextCentered("ESC: main menu (T brings you back here)", screenWidth / 2,
+                             cardY + cardH - 40, 20, DARKGRAY);
         }
-        if (IsKeyPressed(KEY_ESCAPE)) {
-            CloseWindow();
+    }
+
+    // Against the computer the roles stay fixed for the whole series and the
+    // words are English (the dictionary's). The user's own values are kept
+    // aside and put back by RestoreUserSettings when the series ends or is left.
+    void ApplyRivalOverrides() {
+        RestoreUserSettings();
+        if (rival == RivalMode::HUMAN) {
+            match.settings.swapRoles = true;
+            return;
         }
+        userSettings = UserSettings{ true, match.settings.starterIsP1, match.settings.swapRoles,
+                                     match.settings.alphabet };
+        match.settings.starterIsP1 = (rival == RivalMode::COMPUTER_GUESSER);
+        match.settings.swapRoles = false;
+        match.settings.alphabet = AlphabetId::ENGLISH;
+    }
+
+    void RestoreUserSettings() {
+        if (!userSettings.saved) return;
+        match.settings.starterIsP1 = userSettings.starterIsP1;
+        match.settings.swapRoles = userSettings.swapRoles;
+        match.settings.alphabet = userSettings.alphabet;
+        userSettings.saved = false;
     }
 
     void ResetToLobby() {
-        currentRound = 1;
-        player1Score = 0;
-        player2Score = 0;
-        player1IsSetter = starterIsP1;
+        RestoreUserSettings();
+        match.currentRound = 1;
+        match.player1Score = 0;
+        match.player2Score = 0;
+        match.player1IsSetter = match.settings.starterIsP1;
         ResetRoundState();
         ResetWordInput();
         ResetSettingsInput();
@@ -1698,113 +2634,164 @@ private:
     
 
     void DrawSummary() {
-        ClearBackground(BG_COLOR);
-
-        int margin = 20;
-        int cardX = margin;
-        int cardY = margin;
-        int cardW = screenWidth - 2 * margin;
-        int cardH = screenHeight - 2 * margin;
-
-        DrawRectangle(cardX + 6, cardY + 8, cardW, cardH, Fade(BLACK, 0.18f));
-        DrawRectangle(cardX, cardY, cardW, cardH, RAYWHITE);
-        DrawRectangleLines(cardX, cardY, cardW, cardH, BLACK);
+        auto [cardX, cardY, cardW, cardH] = layout.Card();
 
         DrawTextSmooth("GAME OVER", cardX + 40, cardY + 40, 34, BLACK, 2.0f);
 
-        string rStr = "Rounds played: " + std::to_string(totalRounds);
-        DrawTextSmooth(rStr.c_str(), cardX + 40, cardY + 100, 24, BLACK);
+        if (roundsLabel.Changed(match.settings.totalRounds)) {
+            roundsLabel.Format("Rounds played: %d", match.settings.totalRounds);
+        }
+        DrawTextSmooth(roundsLabel.text, cardX + 40, cardY + 100, 24, BLACK);
 
-        string p1Str = player1Name + "  -  " + std::to_string(player1Score) + " pts";
-        string p2Str = player2Name + "  -  " + std::to_string(player2Score) + " pts";
-        DrawTextSmooth(p1Str.c_str(), cardX + 40, cardY + 150, 24, BLACK);
-        DrawTextSmooth(p2Str.c_str(), cardX + 40, cardY + 190, 24, BLACK);
+        if (p1SummaryLabel.Changed(namesVersion, match.player1Score)) {
+            p1SummaryLabel.Format("%s  -  %d pts", player1Name.c_str(), match.player1Score);
+        }
+        if (p2SummaryLabel.Changed(namesVersion, match.player2Score)) {
+            p2SummaryLabel.Format("%s  -  %d pts", player2Name.c_str(), match.player2Score);
+        }
+        DrawTextSmooth(p1SummaryLabel.text, cardX + 40, cardY + 150, 24, BLACK);
+        DrawTextSmooth(p2SummaryLabel.text, cardX + 40, cardY + 190, 24, BLACK);
 
         // Winner text (bigger + colored + centered)
-        string winnerMsg;
         Color winnerColor = BLACK;
 
-        if (player1Score > player2Score) {
-            winnerMsg = "WINNER: " + player1Name;
-            winnerColor = GREEN;
-        } else if (player2Score > player1Score) {
-            winnerMsg = "WINNER: " + player2Name;
+        if (winnerLabel.Changed(namesVersion, match.player1Score, match.player2Score)) {
+            if (match.player1Score > match.player2Score) {
+                winnerLabel.Format("WINNER: %s", player1Name.c_str());
+            } else if (match.player2Score > match.player1Score) {
+                winnerLabel.Format("WINNER: %s", player2Name.c_str());
+            } else {
+                winnerLabel.Format("IT'S A TIE!");
+            }
+        }
+        if (match.player1Score != match.player2Score) {
             winnerColor = GREEN;
         } else {
-            winnerMsg = "IT'S A TIE!";
             winnerColor = DARKGRAY;
         }
 
         int winnerFontSize = 40;
         float winnerSpacing = 2.0f;
-        Vector2 textSize = MeasureTextEx(uiFont, winnerMsg.c_str(),
+        Vector2 textSize = textCache.Measure(winnerLabel.text,
                                         (float)winnerFontSize, winnerSpacing);
 
         int winnerX = cardX + (cardW - (int)textSize.x) / 2;
         int winnerY = cardY + 240;
 
-        DrawTextEx(uiFont, winnerMsg.c_str(),
-                Vector2{ (float)winnerX, (float)winnerY },
-                (float)winnerFontSize, winnerSpacing, winnerColor);
+        fonts.Queue(winnerLabel.text, Vector2{ (float)winnerX, (float)winnerY },
+                    (float)winnerFontSize, winnerSpacing, winnerColor);
 
         // Buttons: back to lobby & quit
-        int btnW = 220;
-        int btnH = 50;
-        int btnY = cardY + cardH - 130;
-
-        Rectangle lobbyBtn = { (float)(cardX + 40), (float)btnY, (float)btnW, (float)btnH };
-        Rectangle quitBtn  = { (float)(cardX + cardW - 40 - btnW), (float)btnY, (float)btnW, (float)btnH };
+        const Rectangle& lobbyBtn = layout[UiRect::SUMMARY_LOBBY];
+        const Rectangle& quitBtn = layout[UiRect::SUMMARY_QUIT];
 
         Vector2 mouse = GetMousePosition();
 
-        DrawButton(lobbyBtn, "MAIN MENU", true, CheckCollisionPointRec(mouse, lobbyBtn));
+        DrawButton(lobbyBtn, kiosk.match >= 0 ? "BRACKET" : "MAIN MENU", true, CheckCollisionPointRec(mouse, lobbyBtn));
         DrawButton(quitBtn,  "QUIT GAME",     false, CheckCollisionPointRec(mouse, quitBtn));
 
         DrawTextSmooth("ENTER / MAIN MENU   |   ESC / QUIT GAME",
                     cardX + 40, cardY + cardH - 40, 20, DARKGRAY);
 
-        // ---- Hangman standing on the right ----
-        int oldLives = lives;
-        bool oldWin = win;
-
-        lives = 6;   // draw full body (steps 1..6, 7 adds X eyes)
-        win = false; // avoid jump animation
-
+        // ---- Hangman standing on the right: full body, no X eyes, still ----
         int hangmanX = cardX + cardW - 260;
         int hangmanY = cardY + 140;
-        DrawHangman(hangmanX, hangmanY);
-
-        lives = oldLives;
-        win = oldWin;
+        DrawHangman(hangmanX, hangmanY, 6);
     }
 };
 
 // ============================================================
 // main
 // ============================================================
-int main() {
-    const int W = 1200;   // bigger window
-    const int H = 680;
+int main(int argc, char** argv) {
+    auto launchTime = std::chrono::steady_clock::now();
+
+    // Initial window = the layout canvas; it can be resized freely from there
+    const int W = UI_CANVAS_W;
+    const int H = UI_CANVAS_H;
+
+    FramePacer pacer;
+    pacer.policy.ParseArgs(argc, argv);
+
+    ReplayOptions replayOptions;
+    replayOptions.ParseArgs(argc, argv);
 
+    // Headless replay still needs a GL context for fonts and render targets
+    SetConfigFlags(FLAG_WINDOW_RESIZABLE | (replayOptions.fast ? FLAG_WINDOW_HIDDEN : 0));
     InitWindow(W, H, "Hangman - 2 Player (OOP + Raylib)");
-    SetTargetFPS(60);
+    SetWindowMinSize(W / 2, H / 2);
+    pacer.Apply(PaceMode::ACTIVE);
     
     // Initialize audio device
     InitAudioDevice(); 
 
-    HangmanGame game(W, H);
-
-    while (!WindowShouldClose()) {
-        game.Update();
+    // The game owns textures, render targets and audio streams: it goes out
+    // of scope (and releases them) before the device and the window close
+    int exitCode = 0;
+    {
+        HangmanGame game(W, H);
+
+        RuleOptions ruleOptions;
+        ruleOptions.ParseArgs(argc, argv);
+        game.SetRules(ruleOptions);
+
+        TelemetryOptions telemetryOptions;
+        telemetryOptions.ParseArgs(argc, argv);
+        game.StartTelemetry(telemetryOptions);
+
+        // A replay reproduces a local session, so it never opens the network
+        bool replaying = replayOptions.replayPath != nullptr && game.StartReplay(replayOptions.replayPath);
+        if (!replaying) {
+            NetOptions netOptions;
+            netOptions.ParseArgs(argc, argv);
+            // A networked session starts a series of its own
+            bool networked = netOptions.hostPort > 0 || netOptions.joinPort > 0;
+            if (replayOptions.recordPath == nullptr) game.RestoreSnapshot(!networked);
+            game.StartNetwork(netOptions);
+
+            // Threads make the bracket's timing nondeterministic: never recorded
+            TournamentOptions tournamentOptions;
+            tournamentOptions.ParseArgs(argc, argv);
+            if (tournamentOptions.Enabled() && !networked && replayOptions.recordPath == nullptr) {
+                game.StartTournament(tournamentOptions);
+            }
+        }
+        if (replayOptions.recordPath != nullptr) game.StartRecording(replayOptions.recordPath);
+
+        if (replaying && replayOptions.fast) {
+            // No drawing and no frame cap: Update() as fast as it runs
+            auto begin = std::chrono::steady_clock::now();
+            while (game.Replaying()) game.Update();
+            double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+            const GameClock& clock = game.Clock();
+            std::printf("replay: %llu frames, %.1f s of play in %.3f s (%.0fx), %d divergences\n",
+                        (unsigned long long)clock.Frames(), clock.Now(), wall,
+                        wall > 0.0 ? clock.Now() / wall : 0.0, game.ReplayDivergences());
+            exitCode = game.ReplayDivergences() == 0 ? 0 : 2;
+        } else {
+            while (!WindowShouldClose()) {
+                game.Update();
+                pacer.Apply(game.RequiredPace());
+
+                BeginDrawing();
+                game.Draw();
+                EndDrawing();
+                pacer.CountFrame(GetFrameTime());
+
+                if (pacer.framesRendered == 1) {
+                    double ms = std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - launchTime).count();
+                    TraceLog(LOG_INFO, "STARTUP: first frame after %.1f ms", ms);
+                }
+            }
 
-        BeginDrawing();
-        game.Draw();
-        EndDrawing();
+            TraceLog(LOG_INFO, "PACER: %llu frames rendered, %llu skipped",
+                     pacer.framesRendered, pacer.framesSkipped);
+        }
     }
-    
-    // Close audio device
-    CloseAudioDevice(); 
 
+    CloseAudioDevice();
     CloseWindow();
-    return 0;
+    return exitCode;
 }
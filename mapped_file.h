@@ -0,0 +1,34 @@
+#pragma once
+// Read-only memory-mapped file, plus atomic whole-file writes. Kept in its
+// own translation unit so the platform headers (windows.h in particular)
+// never meet raylib.h.
+#include <cstddef>
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { Close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Returns false (and stays closed) if the file is missing or empty
+    bool Open(const char* path);
+    void Close();
+
+    bool IsOpen() const { return data != nullptr; }
+    const unsigned char* Data() const { return data; }
+    size_t Size() const { return size; }
+
+private:
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mapHandle = nullptr;
+#endif
+};
+
+// Writes data to path + ".tmp", flushes it to disk, then replaces path with
+// it in one step, so readers see the old file or the new one, never a torn one
+bool WriteFileAtomic(const char* path, const void* data, size_t size);
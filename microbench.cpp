@@ -0,0 +1,410 @@
+// Microbenchmarks for the game-logic hot paths (no raylib). Flags and JSON
+// output follow Google Benchmark, so its compare.py can diff two runs, but
+// nothing outside this file is needed to build or run it.
+//
+// Usage: microbench [--benchmark_filter=REGEX] [--benchmark_min_time=0.5s]
+//                   [--benchmark_format=console|json] [--benchmark_out=FILE]
+//                   [--benchmark_list_tests]
+#include "hangman_rules.h"
+#include "leaderboard_store.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <regex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+// ---------------- Harness ----------------
+
+template <class T>
+inline void DoNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+class State {
+public:
+    State(uint64_t iterations, int64_t arg) : iterations(iterations), arg(arg) {}
+
+    int64_t range(int) const { return arg; }
+    void SetItemsProcessed(int64_t n) { items = n; }
+
+    // for (auto _ : state) { ... } times exactly the loop
+    struct Value { ~Value() {} }; // non-trivial, so an unused loop variable is not warned about
+    struct Iterator {
+        uint64_t left;
+        State* state;
+        bool operator!=(const Iterator&) {
+            if (left != 0) return true;
+            state->Stop();
+            return false;
+        }
+        void operator++() { --left; }
+        Value operator*() const { return Value{}; }
+    };
+    Iterator begin() {
+        Start();
+        return Iterator{ iterations, this };
+    }
+    Iterator end() { return Iterator{ 0, this }; }
+
+    uint64_t iterations;
+    int64_t arg;
+    int64_t items = 0;
+    double realSeconds = 0.0;
+    double cpuSeconds = 0.0;
+
+private:
+    std::chrono::steady_clock::time_point realStart;
+    std::clock_t cpuStart = 0;
+
+    void Start() {
+        cpuStart = std::clock();
+        realStart = std::chrono::steady_clock::now();
+    }
+    void Stop() {
+        auto realEnd = std::chrono::steady_clock::now();
+        std::clock_t cpuEnd = std::clock();
+        realSeconds = std::chrono::duration<double>(realEnd - realStart).count();
+        cpuSeconds = (double)(cpuEnd - cpuStart) / CLOCKS_PER_SEC;
+    }
+};
+
+typedef void (*BenchFn)(State&);
+
+struct Benchmark {
+    string name;
+    BenchFn fn;
+    vector<int64_t> args;
+
+    Benchmark* Arg(int64_t a) { args.push_back(a); return this; }
+    Benchmark* DenseRange(int64_t lo, int64_t hi) {
+        for (int64_t a = lo; a <= hi; ++a) args.push_back(a);
+        return this;
+    }
+    // lo, lo*mult, ... up to hi (inclusive)
+    Benchmark* Range(int64_t lo, int64_t hi, int64_t mult = 8) {
+        for (int64_t a = lo; a < hi; a *= mult) args.push_back(a);
+        args.push_back(hi);
+        return this;
+    }
+};
+
+static vector<Benchmark*>& Registry() {
+    static vector<Benchmark*> all;
+    return all;
+}
+
+static Benchmark* Register(const char* name, BenchFn fn) {
+    Benchmark* b = new Benchmark{ name, fn, {} };
+    Registry().push_back(b);
+    return b;
+}
+
+#define BENCHMARK(fn) static Benchmark* fn##_registered = Register(#fn, fn)
+
+struct RunResult {
+    string name;
+    int family;
+    int instance;
+    uint64_t iterations;
+    double realNs;   // per iteration
+    double cpuNs;
+    double itemsPerSecond;
+};
+
+// Grows the iteration count until one run lasts at least minTime
+static RunResult Run(const Benchmark& b, int family, int instance, int64_t arg, double minTime) {
+    uint64_t iterations = 1;
+    for (;;) {
+        State state(iterations, arg);
+        b.fn(state);
+
+        bool enough = state.realSeconds >= minTime || iterations >= 1000000000ull;
+        if (enough) {
+            RunResult r;
+            r.name = b.name + "/" + std::to_string(arg);
+            r.family = family;
+            r.instance = instance;
+            r.iterations = iterations;
+            r.realNs = state.realSeconds * 1e9 / iterations;
+            r.cpuNs = state.cpuSeconds * 1e9 / iterations;
+            r.itemsPerSecond = (state.items > 0 && state.realSeconds > 0.0)
+                             ? state.items / state.realSeconds : 0.0;
+            return r;
+        }
+
+        double multiplier = state.realSeconds > 0.0 ? minTime * 1.4 / state.realSeconds : 10.0;
+        if (multiplier > 10.0) multiplier = 10.0;
+        if (multiplier < 2.0) multiplier = 2.0;
+        iterations = (uint64_t)(iterations * multiplier);
+    }
+}
+
+static void WriteJson(FILE* f, const char* executable, const vector<RunResult>& results) {
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::fprintf(f, "{\n  \"context\": {\n");
+    std::fprintf(f, "    \"date\": \"%s\",\n", date);
+    std::fprintf(f, "    \"executable\": \"%s\",\n", executable);
+    std::fprintf(f, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+#ifdef NDEBUG
+    std::fprintf(f, "    \"library_build_type\": \"release\"\n");
+#else
+    std::fprintf(f, "    \"library_build_type\": \"debug\"\n");
+#endif
+    std::fprintf(f, "  },\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); ++i) {
+        const RunResult& r = results[i];
+        std::fprintf(f, "    {\n");
+        std::fprintf(f, "      \"name\": \"%s\",\n", r.name.c_str());
+        std::fprintf(f, "      \"family_index\": %d,\n", r.family);
+        std::fprintf(f, "      \"per_family_instance_index\": %d,\n", r.instance);
+        std::fprintf(f, "      \"run_name\": \"%s\",\n", r.name.c_str());
+        std::fprintf(f, "      \"run_type\": \"iteration\",\n");
+        std::fprintf(f, "      \"repetitions\": 1,\n");
+        std::fprintf(f, "      \"repetition_index\": 0,\n");
+        std::fprintf(f, "      \"threads\": 1,\n");
+        std::fprintf(f, "      \"iterations\": %llu,\n", (unsigned long long)r.iterations);
+        std::fprintf(f, "      \"real_time\": %.6e,\n", r.realNs);
+        std::fprintf(f, "      \"cpu_time\": %.6e,\n", r.cpuNs);
+        if (r.itemsPerSecond > 0.0) {
+            std::fprintf(f, "      \"time_unit\": \"ns\",\n");
+            std::fprintf(f, "      \"items_per_second\": %.6e\n", r.itemsPerSecond);
+        } else {
+            std::fprintf(f, "      \"time_unit\": \"ns\"\n");
+        }
+        std::fprintf(f, "    }%s\n", i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+}
+
+static void PrintConsoleHeader() {
+    std::printf("%-36s %14s %14s %12s %16s\n", "Benchmark", "Time", "CPU", "Iterations", "Items/s");
+    std::printf("%s\n", string(96, '-').c_str());
+}
+
+static void PrintConsole(const RunResult& r) {
+    char items[32] = "";
+    if (r.itemsPerSecond > 0.0) std::snprintf(items, sizeof(items), "%.4gM/s", r.itemsPerSecond / 1e6);
+    std::printf("%-36s %11.1f ns %11.1f ns %12llu %16s\n", r.name.c_str(), r.realNs, r.cpuNs,
+                (unsigned long long)r.iterations, items);
+    std::fflush(stdout);
+}
+
+// ---------------- Inputs ----------------
+
+static const char kGuessOrder[] = "ETAOINSHRDLCUMWFGYPBVKJXQZ";
+
+// Deterministic word of n letters (a space every 8th position past 8)
+static string MakeWord(int64_t n, bool spaces = false) {
+    std::mt19937 rng((uint32_t)n * 2654435761u);
+    string w;
+    w.reserve((size_t)n);
+    for (int64_t i = 0; i < n; ++i) {
+        if (spaces && i > 0 && i % 8 == 7) w.push_back(' ');
+        else w.push_back((char)('a' + rng() % 26));
+    }
+    return w;
+}
+
+// ---------------- Benchmarks ----------------
+
+// One whole round: StartRound, then guesses in frequency order until it ends.
+// items = guesses, so items/s is the ProcessGuess rate including setup.
+// Match is a rule variant; 26 lives so the word is always fully revealed.
+template <class Match>
+static void ProcessGuessRound(State& state, Match& match) {
+    match.StartMatch();
+    string word = MakeWord(state.range(0));
+    int64_t guesses = 0;
+
+    for (auto _ : state) {
+        match.StartRound(word, "hint");
+        for (const char* g = kGuessOrder; *g && !match.gameOver; ++g) {
+            DoNotOptimize(match.ProcessGuess(*g));
+            guesses++;
+        }
+    }
+    state.SetItemsProcessed(guesses);
+}
+
+// Compile-time rules, as the headless tools build them
+static void BM_ProcessGuess(State& state) {
+    BasicMatch<ClassicScoring, NoTimer, FixedLives<26>> match;
+    ProcessGuessRound(state, match);
+}
+BENCHMARK(BM_ProcessGuess)->DenseRange(1, WORD_MAX_CHARS);
+
+// The game's variant: every rule read from the settings
+static void BM_ProcessGuessRuntime(State& state) {
+    HangmanMatch match;
+    match.settings.maxLivesSetting = 26;
+    ProcessGuessRound(state, match);
+}
+BENCHMARK(BM_ProcessGuessRuntime)->DenseRange(1, WORD_MAX_CHARS);
+
+// The loop that builds shownWord when a round starts
+static void BM_MaskWord(State& state) {
+    string word = MakeWord(state.range(0), true);
+    string shown;
+    for (auto _ : state) {
+        MaskWord(word, shown);
+        DoNotOptimize(shown.data());
+    }
+    state.SetItemsProcessed((int64_t)state.iterations * state.range(0));
+}
+BENCHMARK(BM_MaskWord)->DenseRange(1, 20)->Arg(1000);
+
+static void BM_SpacedWord(State& state) {
+    string shown;
+    MaskWord(MakeWord(state.range(0), true), shown);
+    for (size_t i = 0; i < shown.size(); i += 3) shown[i] = 'X'; // some revealed letters
+    char out[96];
+    for (auto _ : state) {
+        SpacedWord(shown, out, (int)sizeof(out));
+        DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_SpacedWord)->DenseRange(1, 20)->Arg(48);
+
+static void BM_Upper(State& state) {
+    string word = MakeWord(state.range(0), true);
+    for (auto _ : state) {
+        string up = Upper(word);
+        DoNotOptimize(up.data());
+    }
+    state.SetItemsProcessed((int64_t)state.iterations * state.range(0));
+}
+BENCHMARK(BM_Upper)->DenseRange(1, 20)->Arg(1000);
+
+// Worst case: the only letter is the last character
+static void BM_WordValid(State& state) {
+    string word((size_t)state.range(0) - 1, ' ');
+    word.push_back('q');
+    for (auto _ : state) {
+        DoNotOptimize(WordValid(word));
+    }
+    state.SetItemsProcessed((int64_t)state.iterations * state.range(0));
+}
+BENCHMARK(BM_WordValid)->Arg(1)->Arg(8)->Arg(20)->Arg(1000);
+
+// What UpdateLeaderboardScores does at the end of a series: two players'
+// scores recorded into a board that already holds range(0) players
+static void LeaderboardRecord(State& state, bool logged) {
+    const char* base = "microbench_leaderboard";
+    std::remove("microbench_leaderboard.log");
+    std::remove("microbench_leaderboard.idx");
+    {
+        LeaderboardStore board(base);
+        if (logged) board.Open();
+
+        int64_t players = state.range(0);
+        vector<string> names;
+        names.reserve((size_t)players);
+        for (int64_t i = 0; i < players; ++i) {
+            names.push_back("player" + std::to_string(i));
+            board.Record(names.back(), (int)(i % 7) + 1);
+        }
+
+        size_t next = 0;
+        for (auto _ : state) {
+            board.Record(names[next], 3);
+            board.Record(names[(next + players / 2) % names.size()], 1);
+            if (++next == names.size()) next = 0;
+        }
+        DoNotOptimize(board.Version());
+    }
+    std::remove("microbench_leaderboard.log");
+    std::remove("microbench_leaderboard.idx");
+}
+
+static void BM_LeaderboardRecord(State& state) { LeaderboardRecord(state, false); }
+BENCHMARK(BM_LeaderboardRecord)->Range(10, 100000, 10);
+
+// Same, with the append-only log on disk (one fflush per record)
+static void BM_LeaderboardRecordLogged(State& state) { LeaderboardRecord(state, true); }
+BENCHMARK(BM_LeaderboardRecordLogged)->Range(10, 100000, 10);
+
+// ---------------- main ----------------
+
+static const char* FlagValue(const char* arg, const char* flag) {
+    size_t n = std::strlen(flag);
+    if (std::strncmp(arg, flag, n) == 0 && arg[n] == '=') return arg + n + 1;
+    return nullptr;
+}
+
+int main(int argc, char** argv) {
+    string filter = ".";
+    double minTime = 0.5;
+    bool json = false;
+    bool list = false;
+    const char* outPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* v;
+        if ((v = FlagValue(argv[i], "--benchmark_filter"))) filter = v;
+        else if ((v = FlagValue(argv[i], "--benchmark_min_time"))) minTime = std::atof(v); // "0.5" or "0.5s"
+        else if ((v = FlagValue(argv[i], "--benchmark_format"))) json = std::strcmp(v, "json") == 0;
+        else if ((v = FlagValue(argv[i], "--benchmark_out"))) outPath = v;
+        else if (std::strcmp(argv[i], "--benchmark_list_tests") == 0) list = true;
+        else {
+            std::fprintf(stderr, "unknown flag %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if (minTime <= 0.0) minTime = 0.5;
+
+    std::regex pattern;
+    try {
+        pattern = std::regex(filter);
+    } catch (const std::regex_error&) {
+        std::fprintf(stderr, "bad --benchmark_filter regex: %s\n", filter.c_str());
+        return 1;
+    }
+
+    if (!json && !list) PrintConsoleHeader();
+    vector<RunResult> results;
+    int family = 0;
+    for (const Benchmark* b : Registry()) {
+        int instance = 0;
+        for (int64_t arg : b->args) {
+            string name = b->name + "/" + std::to_string(arg);
+            if (!std::regex_search(name, pattern)) continue;
+            if (list) {
+                std::printf("%s\n", name.c_str());
+                continue;
+            }
+            results.push_back(Run(*b, family, instance++, arg, minTime));
+            if (!json) PrintConsole(results.back());
+        }
+        family++;
+    }
+    if (list) return 0;
+
+    if (json) WriteJson(stdout, argv[0], results);
+    if (outPath != nullptr) {
+        FILE* f = std::fopen(outPath, "w");
+        if (f == nullptr) {
+            std::fprintf(stderr, "cannot write %s\n", outPath);
+            return 1;
+        }
+        WriteJson(f, argv[0], results);
+        std::fclose(f);
+    }
+    return 0;
+}
@@ -0,0 +1,265 @@
+#pragma once
+// Wire protocol between the match authority (the hosting game, or a server)
+// and a remote player. Frames are [type u8][payload length u8][payload],
+// integers little-endian, strings u8-length-prefixed. Only deltas are sent:
+// a guess is one letter (a u16 code point), its answer is the letter's
+// position bitmask (code point positions).
+//
+//   authority -> player                 player -> authority
+//   CONFIG       settings, alphabet,    HELLO     player name
+//                names
+//   ROUND_START  length, spaces, hint   SET_WORD  word + hint (as setter)
+//   REVEAL       letter, positions,     GUESS     letter (as guesser)
+//                lives, result
+//   TIMER_SYNC   time left
+//   ROUND_END    result, scores, word
+//   PING / PONG  either direction, echo a timestamp for round-trip time
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+enum class NetMsg : uint8_t {
+    HELLO = 1,
+    CONFIG,
+    SET_WORD,
+    ROUND_START,
+    GUESS,
+    REVEAL,
+    TIMER_SYNC,
+    ROUND_END,
+    PING,
+    PONG
+};
+
+static const int NET_HEADER = 2;
+static const int NET_MAX_PAYLOAD = 255;
+static const int NET_MAX_FRAME = NET_HEADER + NET_MAX_PAYLOAD;
+
+// Decoded message; only the fields of its type are meaningful
+struct NetMessage {
+    NetMsg type = NetMsg::PING;
+
+    std::string text;        // HELLO name, SET_WORD word, ROUND_START hint, ROUND_END word, CONFIG p1 name
+    std::string text2;       // SET_WORD hint, CONFIG p2 name
+
+    uint16_t letter = 0;     // GUESS, REVEAL: upper-case code point
+    uint8_t lives = 0;       // REVEAL: wrong guesses so far
+    uint8_t result = 0;      // REVEAL: GuessResult
+    uint8_t length = 0;      // ROUND_START: code points
+    uint32_t mask = 0;       // REVEAL positions, ROUND_START space positions
+    uint32_t timeCs = 0;     // ROUND_START, TIMER_SYNC: time left in 1/100 s
+    uint32_t stamp = 0;      // PING, PONG
+
+    // CONFIG
+    uint8_t totalRounds = 0;
+    uint8_t maxLives = 0;
+    uint16_t timeLimit = 0;  // seconds
+    bool starterIsP1 = true;
+    bool youAreP1 = false;   // which side the receiver plays
+    uint8_t alphabet = 0;    // AlphabetId
+
+    // ROUND_END
+    bool win = false;
+    uint8_t p1Score = 0;
+    uint8_t p2Score = 0;
+};
+
+namespace net_wire {
+
+struct Writer {
+    uint8_t* out;
+    int n = 0;
+    bool ok = true;
+
+    void U8(uint32_t v) {
+        if (n >= NET_MAX_PAYLOAD) { ok = false; return; }
+        out[n++] = (uint8_t)v;
+    }
+    void U16(uint32_t v) { U8(v); U8(v >> 8); }
+    void U32(uint32_t v) { U16(v); U16(v >> 16); }
+    // Up to 255 bytes, cut back to a code-point boundary. The longest frame,
+    // SET_WORD (80-byte word + 160-byte hint + 2 length bytes), fits.
+    void Str(const std::string& s) {
+        size_t len = s.size() > 255 ? 255 : s.size();
+        while (len < s.size() && ((uint8_t)s[len] & 0xC0) == 0x80) --len;
+        U8((uint32_t)len);
+        for (size_t i = 0; i < len; ++i) U8((uint8_t)s[i]);
+    }
+};
+
+struct Reader {
+    const uint8_t* in;
+    int size;
+    int n = 0;
+    bool ok = true;
+
+    uint32_t U8() {
+        if (n >= size) { ok = false; return 0; }
+        return in[n++];
+    }
+    uint32_t U16() { uint32_t lo = U8(); return lo | (U8() << 8); }
+    uint32_t U32() { uint32_t lo = U16(); return lo | (U16() << 16); }
+    std::string Str() {
+        uint32_t len = U8();
+        if (n + (int)len > size) { ok = false; return std::string(); }
+        std::string s((const char*)in + n, len);
+        n += (int)len;
+        return s;
+    }
+};
+
+} // namespace net_wire
+
+// Writes one frame into out (at least NET_MAX_FRAME bytes); returns its size or 0
+inline int EncodeMessage(const NetMessage& m, uint8_t* out) {
+    net_wire::Writer w{ out + NET_HEADER };
+    switch (m.type) {
+        case NetMsg::HELLO:
+            w.Str(m.text);
+            break;
+        case NetMsg::CONFIG:
+            w.U8(m.totalRounds);
+            w.U8(m.maxLives);
+            w.U16(m.timeLimit);
+            w.U8((m.starterIsP1 ? 1u : 0u) | (m.youAreP1 ? 2u : 0u));
+            w.U8(m.alphabet);
+            w.Str(m.text);
+            w.Str(m.text2);
+            break;
+        case NetMsg::SET_WORD:
+            w.Str(m.text);
+            w.Str(m.text2);
+            break;
+        case NetMsg::ROUND_START:
+            w.U8(m.length);
+            w.U32(m.mask);
+            w.U32(m.timeCs);
+            w.Str(m.text);
+            break;
+        case NetMsg::GUESS:
+            w.U16(m.letter);
+            break;
+        case NetMsg::REVEAL:
+            w.U16(m.letter);
+            w.U32(m.mask);
+            w.U8(m.lives);
+            w.U8(m.result);
+            break;
+        case NetMsg::TIMER_SYNC:
+            w.U32(m.timeCs);
+            break;
+        case NetMsg::ROUND_END:
+            w.U8(m.win ? 1u : 0u);
+            w.U8(m.p1Score);
+            w.U8(m.p2Score);
+            w.Str(m.text);
+            break;
+        case NetMsg::PING:
+        case NetMsg::PONG:
+            w.U32(m.stamp);
+            break;
+        default:
+            return 0;
+    }
+    if (!w.ok) return 0;
+    out[0] = (uint8_t)m.type;
+    out[1] = (uint8_t)w.n;
+    return NET_HEADER + w.n;
+}
+
+// Decodes one frame's payload; false on a malformed or unknown frame
+inline bool DecodeMessage(uint8_t type, const uint8_t* payload, int size, NetMessage& m) {
+    m = NetMessage{};
+    m.type = (NetMsg)type;
+    net_wire::Reader r{ payload, size };
+    switch (m.type) {
+        case NetMsg::HELLO:
+            m.text = r.Str();
+            break;
+        case NetMsg::CONFIG: {
+            m.totalRounds = (uint8_t)r.U8();
+            m.maxLives = (uint8_t)r.U8();
+            m.timeLimit = (uint16_t)r.U16();
+            uint32_t flags = r.U8();
+            m.starterIsP1 = (flags & 1u) != 0;
+            m.youAreP1 = (flags & 2u) != 0;
+            m.alphabet = (uint8_t)r.U8();
+            m.text = r.Str();
+            m.text2 = r.Str();
+            break;
+        }
+        case NetMsg::SET_WORD:
+            m.text = r.Str();
+            m.text2 = r.Str();
+            break;
+        case NetMsg::ROUND_START:
+            m.length = (uint8_t)r.U8();
+            m.mask = r.U32();
+            m.timeCs = r.U32();
+            m.text = r.Str();
+            break;
+        case NetMsg::GUESS:
+            m.letter = (uint16_t)r.U16();
+            break;
+        case NetMsg::REVEAL:
+            m.letter = (uint16_t)r.U16();
+            m.mask = r.U32();
+            m.lives = (uint8_t)r.U8();
+            m.result = (uint8_t)r.U8();
+            break;
+        case NetMsg::TIMER_SYNC:
+            m.timeCs = r.U32();
+            break;
+        case NetMsg::ROUND_END:
+            m.win = r.U8() != 0;
+            m.p1Score = (uint8_t)r.U8();
+            m.p2Score = (uint8_t)r.U8();
+            m.text = r.Str();
+            break;
+        case NetMsg::PING:
+        case NetMsg::PONG:
+            m.stamp = r.U32();
+            break;
+        default:
+            return false;
+    }
+    return r.ok;
+}
+
+// Incremental frame splitter over a byte stream (handles partial reads)
+class FrameReader {
+public:
+    // Appends received bytes; false if the buffer would overflow
+    bool Feed(const uint8_t* data, int size) {
+        if (used + size > (int)sizeof(buf)) return false;
+        std::memcpy(buf + used, data, size);
+        used += size;
+        return true;
+    }
+
+    // Next complete frame; false when more bytes are needed
+    bool Next(uint8_t& type, const uint8_t*& payload, int& size) {
+        if (start > 0 && start == used) { start = used = 0; }
+        if (used - start < NET_HEADER) { Compact(); return false; }
+        int len = buf[start + 1];
+        if (used - start < NET_HEADER + len) { Compact(); return false; }
+
+        type = buf[start];
+        payload = buf + start + NET_HEADER;
+        size = len;
+        start += NET_HEADER + len;
+        return true;
+    }
+
+private:
+    uint8_t buf[NET_MAX_FRAME * 8];
+    int used = 0;
+    int start = 0;
+
+    void Compact() {
+        if (start == 0) return;
+        std::memmove(buf, buf + start, used - start);
+        used -= start;
+        start = 0;
+    }
+};
@@ -0,0 +1,202 @@
+#pragma once
+// One network link for the game, polled once per frame: accepts or finishes
+// connecting, drains the socket into decoded messages, answers pings and
+// flushes queued output. Never blocks.
+//
+// Game messages wait in the inbox until the screen that handles them takes
+// them (e.g. the next ROUND_START stays queued until the player has pressed
+// NEXT), so order is kept without any screen having to look ahead.
+#include "net_protocol.h"
+#include "net_socket.h"
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+// --host PORT / --join HOST:PORT / --name NAME
+struct NetOptions {
+    int hostPort = 0;
+    std::string joinHost;
+    int joinPort = 0;
+    std::string name;
+
+    void ParseArgs(int argc, char** argv) {
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--host") == 0) {
+                hostPort = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--join") == 0) {
+                std::string target = argv[++i];
+                size_t colon = target.rfind(':');
+                if (colon != std::string::npos) {
+                    joinHost = target.substr(0, colon);
+                    joinPort = std::atoi(target.c_str() + colon + 1);
+                }
+            } else if (std::strcmp(argv[i], "--name") == 0) {
+                name = argv[++i];
+            }
+        }
+    }
+};
+
+enum class NetState {
+    OFF,        // hot-seat, no networking
+    LISTENING,  // host waiting for the other player
+    CONNECTING,
+    CONNECTED,
+    FAILED      // join could not connect / connection lost
+};
+
+enum class NetEvent { NONE, CONNECTED, DISCONNECTED };
+
+class NetSession {
+public:
+    static const uint32_t PING_INTERVAL_MS = 1000;
+
+    bool Host(uint16_t port) {
+        isHost = true;
+        state = listener.Listen(port) ? NetState::LISTENING : NetState::FAILED;
+        return state == NetState::LISTENING;
+    }
+
+    bool Join(const char* host, uint16_t port) {
+        isHost = false;
+        state = peer.Connect(host, port) ? NetState::CONNECTING : NetState::FAILED;
+        return state == NetState::CONNECTING;
+    }
+
+    bool Active() const { return state != NetState::OFF; }
+    bool IsHost() const { return isHost; }
+    bool Connected() const { return state == NetState::CONNECTED; }
+    NetState State() const { return state; }
+
+    // Smoothed round-trip time, -1 until the first PONG
+    int RttMs() const { return rttMs < 0.0 ? -1 : (int)(rttMs + 0.5); }
+
+    // nowMs: any monotonic millisecond clock
+    NetEvent Poll(uint32_t nowMs) {
+        NetEvent ev = NetEvent::NONE;
+
+        if (state == NetState::LISTENING && listener.Accept(peer)) {
+            Connect(nowMs);
+            ev = NetEvent::CONNECTED;
+        } else if (state == NetState::CONNECTING) {
+            int r = peer.ConnectResult();
+            if (r > 0) {
+                Connect(nowMs);
+                ev = NetEvent::CONNECTED;
+            } else if (r < 0) {
+                peer.Close();
+                state = NetState::FAILED;
+            }
+        }
+        if (state != NetState::CONNECTED) return ev;
+
+        if (!Receive(nowMs) || !Flush()) {
+            Disconnect();
+            return NetEvent::DISCONNECTED;
+        }
+
+        if (nowMs - lastPingMs >= PING_INTERVAL_MS) {
+            lastPingMs = nowMs;
+            NetMessage ping;
+            ping.type = NetMsg::PING;
+            ping.stamp = nowMs;
+            Send(ping);
+            if (!Flush()) {
+                Disconnect();
+                return NetEvent::DISCONNECTED;
+            }
+        }
+        return ev;
+    }
+
+    // Queued and sent on this or the next Poll
+    void Send(const NetMessage& m) {
+        if (state != NetState::CONNECTED) return;
+        uint8_t frame[NET_MAX_FRAME];
+        int n = EncodeMessage(m, frame);
+        outbox.insert(outbox.end(), frame, frame + n);
+        Flush();
+    }
+
+    bool HasMessage() const { return !inbox.empty(); }
+    const NetMessage& Front() const { return inbox.front(); }
+    void Pop() { inbox.pop_front(); }
+
+private:
+    bool isHost = false;
+    NetState state = NetState::OFF;
+    TcpSocket listener;
+    TcpSocket peer;
+    FrameReader reader;
+    std::vector<uint8_t> outbox;
+    std::deque<NetMessage> inbox;
+
+    uint32_t lastPingMs = 0;
+    double rttMs = -1.0;
+
+    void Connect(uint32_t nowMs) {
+        state = NetState::CONNECTED;
+        reader = FrameReader();
+        outbox.clear();
+        inbox.clear();
+        rttMs = -1.0;
+        lastPingMs = nowMs - PING_INTERVAL_MS; // ping straight away
+    }
+
+    // Host goes back to waiting for someone new; a joiner stays failed
+    void Disconnect() {
+        peer.Close();
+        outbox.clear();
+        inbox.clear();
+        state = isHost ? NetState::LISTENING : NetState::FAILED;
+    }
+
+    bool Receive(uint32_t nowMs) {
+        uint8_t chunk[1024];
+        for (;;) {
+            int n = peer.Recv(chunk, sizeof(chunk));
+            if (n < 0) return false;
+            if (n == 0) break;
+            if (!reader.Feed(chunk, n)) return false;
+
+            uint8_t type;
+            const uint8_t* payload;
+            int size;
+            while (reader.Next(type, payload, size)) {
+                NetMessage m;
+                if (!DecodeMessage(type, payload, size, m)) return false;
+                Handle(m, nowMs);
+            }
+        }
+        return true;
+    }
+
+    // Link-level messages never reach the inbox
+    void Handle(const NetMessage& m, uint32_t nowMs) {
+        if (m.type == NetMsg::PING) {
+            NetMessage pong;
+            pong.type = NetMsg::PONG;
+            pong.stamp = m.stamp;
+            Send(pong);
+        } else if (m.type == NetMsg::PONG) {
+            double sample = (double)(nowMs - m.stamp);
+            rttMs = (rttMs < 0.0) ? sample : rttMs * 0.75 + sample * 0.25;
+        } else {
+            inbox.push_back(m);
+        }
+    }
+
+    bool Flush() {
+        size_t sent = 0;
+        while (sent < outbox.size()) {
+            int n = peer.Send(outbox.data() + sent, outbox.size() - sent);
+            if (n < 0) return false;
+            if (n == 0) break; // kernel buffer full, retry next Poll
+            sent += (size_t)n;
+        }
+        outbox.erase(outbox.begin(), outbox.begin() + sent);
+        return true;
+    }
+};
@@ -0,0 +1,176 @@
+#include "net_socket.h"
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+
+typedef int socklen_t;
+
+static bool StartupOnce() {
+    static bool started = false;
+    if (!started) {
+        WSADATA wsa;
+        started = WSAStartup(MAKEWORD(2, 2), &wsa) == 0;
+    }
+    return started;
+}
+
+static bool WouldBlock() {
+    int e = WSAGetLastError();
+    return e == WSAEWOULDBLOCK || e == WSAEINPROGRESS;
+}
+
+static void CloseHandleOf(intptr_t h) { closesocket((SOCKET)h); }
+
+static void SetNonBlocking(intptr_t h) {
+    u_long on = 1;
+    ioctlsocket((SOCKET)h, FIONBIO, &on);
+}
+
+#define SEND_FLAGS 0
+
+#else
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static bool StartupOnce() { return true; }
+
+static bool WouldBlock() {
+    return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINPROGRESS;
+}
+
+static void CloseHandleOf(intptr_t h) { close((int)h); }
+
+static void SetNonBlocking(intptr_t h) {
+    int flags = fcntl((int)h, F_GETFL, 0);
+    fcntl((int)h, F_SETFL, flags | O_NONBLOCK);
+}
+
+#ifdef MSG_NOSIGNAL
+#define SEND_FLAGS MSG_NOSIGNAL // a dropped peer must not raise SIGPIPE
+#else
+#define SEND_FLAGS 0
+#endif
+#endif
+
+void TcpSocket::Configure() {
+    SetNonBlocking(handle);
+    int one = 1;
+    setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, (const char*)&one, sizeof(one));
+#if !defined(_WIN32) && defined(SO_NOSIGPIPE)
+    setsockopt((int)handle, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+}
+
+bool TcpSocket::Listen(uint16_t port) {
+    Close();
+    if (!StartupOnce()) return false;
+
+    intptr_t h = (intptr_t)socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (h == INVALID) return false;
+
+    int one = 1;
+    setsockopt(h, SOL_SOCKET, SO_REUSEADDR, (const char*)&one, sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(h, (const sockaddr*)&addr, sizeof(addr)) != 0 || listen(h, 4) != 0) {
+        CloseHandleOf(h);
+        return false;
+    }
+
+    handle = h;
+    SetNonBlocking(handle);
+    return true;
+}
+
+bool TcpSocket::Accept(TcpSocket& out) {
+    if (!IsOpen()) return false;
+    intptr_t h = (intptr_t)accept(handle, nullptr, nullptr);
+    if (h == INVALID) return false;
+
+    out.Close();
+    out.handle = h;
+    out.Configure();
+    return true;
+}
+
+bool TcpSocket::Connect(const char* host, uint16_t port) {
+    Close();
+    if (!StartupOnce()) return false;
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* found = nullptr;
+    char portStr[8];
+    std::snprintf(portStr, sizeof(portStr), "%u", (unsigned)port);
+    if (getaddrinfo(host, portStr, &hints, &found) != 0 || found == nullptr) return false;
+
+    intptr_t h = (intptr_t)socket(found->ai_family, found->ai_socktype, found->ai_protocol);
+    if (h == INVALID) {
+        freeaddrinfo(found);
+        return false;
+    }
+
+    handle = h;
+    Configure();
+    int rc = connect(handle, found->ai_addr, (socklen_t)found->ai_addrlen);
+    freeaddrinfo(found);
+    if (rc != 0 && !WouldBlock()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+int TcpSocket::ConnectResult() {
+    if (!IsOpen()) return -1;
+
+    fd_set writable, failed;
+    FD_ZERO(&writable);
+    FD_ZERO(&failed);
+    FD_SET(handle, &writable);
+    FD_SET(handle, &failed);
+    timeval zero{};
+    int n = select((int)handle + 1, nullptr, &writable, &failed, &zero);
+    if (n == 0) return 0;
+    if (n < 0) return -1;
+
+    int err = 0;
+    socklen_t len = sizeof(err);
+    getsockopt(handle, SOL_SOCKET, SO_ERROR, (char*)&err, &len);
+    return (err == 0 && FD_ISSET(handle, &writable)) ? 1 : -1;
+}
+
+int TcpSocket::Send(const void* data, size_t size) {
+    if (!IsOpen()) return -1;
+    int n = (int)send(handle, (const char*)data, (int)size, SEND_FLAGS);
+    if (n >= 0) return n;
+    return WouldBlock() ? 0 : -1;
+}
+
+int TcpSocket::Recv(void* data, size_t size) {
+    if (!IsOpen()) return -1;
+    int n = (int)recv(handle, (char*)data, (int)size, 0);
+    if (n > 0) return n;
+    if (n == 0) return -1; // orderly shutdown
+    return WouldBlock() ? 0 : -1;
+}
+
+void TcpSocket::Close() {
+    if (IsOpen()) CloseHandleOf(handle);
+    handle = INVALID;
+}
@@ -0,0 +1,42 @@
+#pragma once
+// Non-blocking TCP socket. Kept in its own translation unit so the platform
+// headers (winsock2.h in particular) never meet raylib.h.
+//
+// Every call returns immediately: Send/Recv report "would block" as 0, and a
+// Connect is finished later by polling ConnectResult().
+#include <cstddef>
+#include <cstdint>
+
+class TcpSocket {
+public:
+    TcpSocket() = default;
+    ~TcpSocket() { Close(); }
+
+    TcpSocket(const TcpSocket&) = delete;
+    TcpSocket& operator=(const TcpSocket&) = delete;
+
+    // Listening socket on all interfaces
+    bool Listen(uint16_t port);
+
+    // Takes one pending connection into out; false if none is waiting
+    bool Accept(TcpSocket& out);
+
+    // Starts connecting; host may be a name or a numeric address
+    bool Connect(const char* host, uint16_t port);
+
+    // 1 = connected, 0 = still in progress, -1 = failed
+    int ConnectResult();
+
+    // Bytes moved, 0 if the call would block, -1 if the connection is gone
+    int Send(const void* data, size_t size);
+    int Recv(void* data, size_t size);
+
+    void Close();
+    bool IsOpen() const { return handle != INVALID; }
+
+private:
+    static const intptr_t INVALID = -1;
+    intptr_t handle = INVALID; // SOCKET on Windows, fd elsewhere
+
+    void Configure(); // non-blocking + TCP_NODELAY
+};
@@ -0,0 +1,158 @@
+#pragma once
+// On-screen keyboard for the PLAYING screen, one key per letter of the
+// round's alphabet in its order. Layout is computed once per alphabet,
+// hit-testing is plain arithmetic, and all keys are drawn from a baked atlas
+// (one cell per letter and state) as a single textured quad batch.
+#include "raylib.h"
+#include "rlgl.h"
+#include "alphabet.h"
+#include "font_manager.h"
+#include <cstdint>
+#include <string>
+
+class OnScreenKeyboard {
+public:
+    // Up to 28 keys: 7 wide at full size. Larger alphabets get 4 rows of
+    // smaller keys so the keyboard keeps about the same height.
+    static const int SMALL_ABOVE = 28;
+
+    OnScreenKeyboard() { SetAlphabet(AlphabetId::ENGLISH); }
+
+    // Relayout for an alphabet; drops the atlas if the letters changed
+    void SetAlphabet(AlphabetId id) {
+        const Alphabet& a = Alphabet::Get(id);
+        if (&a == alphabet) return;
+        alphabet = &a;
+        keyCount = a.Size();
+        if (keyCount <= SMALL_ABOVE) {
+            cols = 7;
+            boxSize = 40;
+            boxGap = 10;
+            labelSize = 22.0f;
+        } else {
+            cols = (keyCount + 3) / 4;
+            boxSize = 32;
+            boxGap = 6;
+            labelSize = 18.0f;
+        }
+        Unload();
+    }
+
+    const Alphabet& GetAlphabet() const { return *alphabet; }
+    int KeyCount() const { return keyCount; }
+
+    void SetOrigin(int x, int y) {
+        originX = x;
+        originY = y;
+    }
+
+    int Rows() const { return (keyCount + cols - 1) / cols; }
+    int Bottom() const { return originY + Rows() * (boxSize + boxGap); }
+
+    // Key index under the point, or -1 (gaps between keys do not count)
+    int HitTest(Vector2 p) const {
+        float lx = p.x - originX;
+        float ly = p.y - originY;
+        if (lx < 0 || ly < 0) return -1;
+
+        const int pitch = boxSize + boxGap;
+        int col = (int)lx / pitch;
+        int row = (int)ly / pitch;
+        if (col >= cols || lx - col * pitch >= boxSize) return -1;
+        if (ly - row * pitch >= boxSize) return -1;
+
+        int index = row * cols + col;
+        return (index < keyCount) ? index : -1;
+    }
+
+    // Centre of a key (inverse of HitTest, e.g. to replay a recorded key click)
+    Vector2 KeyCenter(int index) const {
+        const int pitch = boxSize + boxGap;
+        return Vector2{ (float)(originX + (index % cols) * pitch + boxSize / 2),
+                        (float)(originY + (index / cols) * pitch + boxSize / 2) };
+    }
+
+    // Bakes both states of every key into the atlas (needs a window); labels
+    // are drawn immediately, not queued, so they land in the atlas
+    void BuildAtlas(const FontManager& fonts) {
+        Unload();
+        atlas = LoadRenderTexture(keyCount * boxSize, 2 * boxSize);
+
+        BeginTextureMode(atlas);
+        ClearBackground(BLANK);
+        for (int state = 0; state < 2; ++state) {
+            for (int i = 0; i < keyCount; ++i) {
+                int bx = i * boxSize;
+                int by = state * boxSize;
+
+                if (state == 1) {
+                    DrawRectangle(bx, by, boxSize, boxSize, LIGHTGRAY);
+                }
+                DrawRectangleLines(bx, by, boxSize, boxSize, BLACK);
+
+                // Letters differ in width outside A-Z, so centre each label
+                std::string txt;
+                Utf8Append(txt, alphabet->Letter(i));
+                Vector2 size = MeasureTextEx(fonts.GetFont(), txt.c_str(), labelSize, 1.5f);
+                fonts.DrawNow(txt.c_str(),
+                              Vector2{ (float)bx + (boxSize - size.x) * 0.5f,
+                                       (float)by + (boxSize - size.y) * 0.5f },
+                              labelSize, 1.5f, BLACK);
+            }
+        }
+        EndTextureMode();
+    }
+
+    bool HasAtlas() const { return atlas.id != 0; }
+
+    // usedMask: bit i set = letter i was already tried
+    void Draw(uint64_t usedMask) const {
+        if (atlas.id == 0) return;
+
+        const float texW = (float)atlas.texture.width;
+        const float texH = (float)atlas.texture.height;
+
+        rlSetTexture(atlas.texture.id);
+        rlBegin(RL_QUADS);
+        rlColor4ub(255, 255, 255, 255);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+
+        for (int i = 0; i < keyCount; ++i) {
+            int state = (int)((usedMask >> i) & 1u);
+            float x0 = (float)(originX + (i % cols) * (boxSize + boxGap));
+            float y0 = (float)(originY + (i / cols) * (boxSize + boxGap));
+            float x1 = x0 + boxSize;
+            float y1 = y0 + boxSize;
+
+            // Render textures are stored bottom-up, so v runs from 1 down to 0
+            float u0 = (float)(i * boxSize) / texW;
+            float u1 = (float)((i + 1) * boxSize) / texW;
+            float v0 = 1.0f - (float)(state * boxSize) / texH;
+            float v1 = 1.0f - (float)((state + 1) * boxSize) / texH;
+
+            rlTexCoord2f(u0, v0); rlVertex2f(x0, y0);
+            rlTexCoord2f(u0, v1); rlVertex2f(x0, y1);
+            rlTexCoord2f(u1, v1); rlVertex2f(x1, y1);
+            rlTexCoord2f(u1, v0); rlVertex2f(x1, y0);
+        }
+
+        rlEnd();
+        rlSetTexture(0);
+    }
+
+    void Unload() {
+        if (atlas.id != 0) UnloadRenderTexture(atlas);
+        atlas = RenderTexture2D{};
+    }
+
+private:
+    const Alphabet* alphabet = nullptr;
+    int keyCount = 0;
+    int cols = 7;
+    int boxSize = 40;
+    int boxGap = 10;
+    float labelSize = 22.0f;
+    int originX = 0;
+    int originY = 0;
+    RenderTexture2D atlas{};
+};
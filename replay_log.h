@@ -0,0 +1,278 @@
+#pragma once
+// Session recording: every frame's delta and input events, plus the settings
+// each series was started with, in a compact binary log. Fed back through the
+// game's input queue and clock it reproduces the session exactly, either in
+// the window or headless as fast as Update() runs.
+//
+// File: ReplayHeader, then records of [tag u8][fields]:
+//   REPLAY_FRAME      varint frame delta (microseconds); starts a frame
+//   InputKind value   LETTER/TEXT: varint codepoint; CLICK: i16 x, i16 y
+//   REPLAY_KEY_CLICK  u8 on-screen keyboard index (a click that hit a key)
+//   REPLAY_SETTINGS   the series settings, checked again on replay
+// Keyboard clicks are stored as keys, not pixels, so they survive layout changes.
+#include "input_events.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+static const char REPLAY_MAGIC[4] = { 'H', 'G', 'R', 'P' };
+static const uint16_t REPLAY_VERSION = 3;   // 2: settings carry the alphabet, 3: LATIN letter indices changed
+
+struct ReplayHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint64_t seed;        // computer setter's word RNG
+    uint32_t dictWords;   // words.dict size, to warn about a different dictionary
+    uint32_t reserved2;
+};
+static_assert(sizeof(ReplayHeader) == 24, "ReplayHeader layout");
+
+enum ReplayTag : uint8_t {
+    // 0 .. 15 are InputKind values
+    REPLAY_FRAME = 0x20,
+    REPLAY_KEY_CLICK,
+    REPLAY_SETTINGS
+};
+
+// What a series was started with (match settings plus the rival choice)
+struct ReplaySettings {
+    uint8_t rounds = 0;
+    uint8_t lives = 0;
+    uint16_t timeLimit = 0;
+    uint8_t flags = 0;      // bit 0: starter is player 1, bit 1: roles swap, bits 2-3: ScoringRule
+    uint8_t rival = 0;
+    uint8_t difficulty = 0;
+    uint8_t alphabet = 0;   // AlphabetId
+
+    bool operator==(const ReplaySettings& o) const {
+        return rounds == o.rounds && lives == o.lives && timeLimit == o.timeLimit &&
+               flags == o.flags && rival == o.rival && difficulty == o.difficulty &&
+               alphabet == o.alphabet;
+    }
+    bool operator!=(const ReplaySettings& o) const { return !(*this == o); }
+};
+
+// One recorded frame, as handed back by ReplayReader
+struct ReplayFrame {
+    uint32_t dtUs = 0;
+    int count = 0;
+    InputEvent events[InputQueue::CAPACITY];
+    int keyIndex[InputQueue::CAPACITY];  // >= 0: CLICK on this keyboard key
+    bool hasSettings = false;
+    ReplaySettings settings;
+};
+
+// --record PATH / --replay PATH [--fast]
+struct ReplayOptions {
+    const char* recordPath = nullptr;
+    const char* replayPath = nullptr;
+    bool fast = false;     // headless: no window drawing, no frame cap
+
+    void ParseArgs(int argc, char** argv) {
+        for (int i = 1; i < argc; ++i) {
+            if (std::strcmp(argv[i], "--fast") == 0) fast = true;
+            else if (i + 1 < argc && std::strcmp(argv[i], "--record") == 0) recordPath = argv[++i];
+            else if (i + 1 < argc && std::strcmp(argv[i], "--replay") == 0) replayPath = argv[++i];
+        }
+        if (replayPath == nullptr) fast = false;
+    }
+};
+
+class ReplayRecorder {
+public:
+    ~ReplayRecorder() { Close(); }
+
+    bool Open(const char* path, uint64_t seed, uint32_t dictWords) {
+        Close();
+        file = std::fopen(path, "wb");
+        if (file == nullptr) return false;
+
+        ReplayHeader h{};
+        std::memcpy(h.magic, REPLAY_MAGIC, 4);
+        h.version = REPLAY_VERSION;
+        h.seed = seed;
+        h.dictWords = dictWords;
+        std::fwrite(&h, sizeof(h), 1, file);
+        return true;
+    }
+
+    bool IsOpen() const { return file != nullptr; }
+
+    void Close() {
+        if (file == nullptr) return;
+        Flush();
+        std::fclose(file);
+        file = nullptr;
+    }
+
+    void Frame(uint32_t dtUs) {
+        // Buffered frames reach the disk once input happens, so a crash
+        // loses at most the idle frames since the last event
+        if (pendingEvents) Flush();
+        pendingEvents = false;
+        U8(REPLAY_FRAME);
+        Varint(dtUs);
+    }
+
+    // keyIndex >= 0 records a CLICK as that on-screen keyboard key
+    void Input(const InputEvent& ev, int keyIndex = -1) {
+        pendingEvents = true;
+        if (ev.kind == InputKind::CLICK && keyIndex >= 0) {
+            U8(REPLAY_KEY_CLICK);
+            U8((uint32_t)keyIndex);
+            return;
+        }
+        U8((uint32_t)ev.kind);
+        if (ev.kind == InputKind::LETTER || ev.kind == InputKind::TEXT) {
+            Varint((uint32_t)ev.codepoint);
+        } else if (ev.kind == InputKind::CLICK) {
+            U16((uint32_t)(int16_t)ev.pos.x);
+            U16((uint32_t)(int16_t)ev.pos.y);
+        }
+    }
+
+    void Settings(const ReplaySettings& s) {
+        pendingEvents = true;
+        U8(REPLAY_SETTINGS);
+        U8(s.rounds);
+        U8(s.lives);
+        U16(s.timeLimit);
+        U8(s.flags);
+        U8(s.rival);
+        U8(s.difficulty);
+        U8(s.alphabet);
+    }
+
+private:
+    FILE* file = nullptr;
+    std::vector<uint8_t> buffer;
+    bool pendingEvents = false;
+
+    void U8(uint32_t v) { buffer.push_back((uint8_t)v); }
+    void U16(uint32_t v) { U8(v); U8(v >> 8); }
+    void Varint(uint32_t v) {
+        while (v >= 0x80) {
+            U8((v & 0x7F) | 0x80);
+            v >>= 7;
+        }
+        U8(v);
+    }
+
+    void Flush() {
+        if (!buffer.empty()) std::fwrite(buffer.data(), 1, buffer.size(), file);
+        buffer.clear();
+        std::fflush(file);
+    }
+};
+
+class ReplayReader {
+public:
+    // Whole log is read up front; false if missing or not a replay
+    bool Open(const char* path) {
+        Close();
+        FILE* f = std::fopen(path, "rb");
+        if (f == nullptr) return false;
+        std::fseek(f, 0, SEEK_END);
+        long size = std::ftell(f);
+        std::fseek(f, 0, SEEK_SET);
+        if (size < (long)sizeof(ReplayHeader)) {
+            std::fclose(f);
+            return false;
+        }
+        data.resize((size_t)size);
+        bool read = std::fread(data.data(), 1, data.size(), f) == data.size();
+        std::fclose(f);
+
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (!read || std::memcmp(header.magic, REPLAY_MAGIC, 4) != 0 || header.version != REPLAY_VERSION) {
+            Close();
+            return false;
+        }
+        pos = sizeof(ReplayHeader);
+        open = true;
+        return true;
+    }
+
+    bool IsOpen() const { return open; }
+    const ReplayHeader& Header() const { return header; }
+
+    void Close() {
+        data.clear();
+        pos = 0;
+        open = false;
+        ok = true;
+    }
+
+    // Next frame; false at the end of the log (or at a damaged record)
+    bool Next(ReplayFrame& f) {
+        if (!open || pos >= data.size() || data[pos] != REPLAY_FRAME) return false;
+        pos++;
+        f.dtUs = Varint();
+        f.count = 0;
+        f.hasSettings = false;
+
+        while (ok && pos < data.size() && data[pos] != REPLAY_FRAME) {
+            uint8_t tag = data[pos++];
+            if (tag == REPLAY_SETTINGS) {
+                f.hasSettings = true;
+                f.settings.rounds = (uint8_t)U8();
+                f.settings.lives = (uint8_t)U8();
+                f.settings.timeLimit = (uint16_t)U16();
+                f.settings.flags = (uint8_t)U8();
+                f.settings.rival = (uint8_t)U8();
+                f.settings.difficulty = (uint8_t)U8();
+                f.settings.alphabet = (uint8_t)U8();
+                continue;
+            }
+
+            InputEvent ev;
+            int key = -1;
+            if (tag == REPLAY_KEY_CLICK) {
+                ev.kind = InputKind::CLICK;
+                key = (int)U8();
+            } else if (tag <= (uint8_t)InputKind::CLICK) {
+                ev.kind = (InputKind)tag;
+                if (ev.kind == InputKind::LETTER || ev.kind == InputKind::TEXT) {
+                    ev.codepoint = (int)Varint();
+                } else if (ev.kind == InputKind::CLICK) {
+                    ev.pos.x = (float)(int16_t)U16();
+                    ev.pos.y = (float)(int16_t)U16();
+                }
+            } else {
+                ok = false;
+                break;
+            }
+            if (f.count < InputQueue::CAPACITY) {
+                f.events[f.count] = ev;
+                f.keyIndex[f.count] = key;
+                f.count++;
+            }
+        }
+        return ok;
+    }
+
+private:
+    std::vector<uint8_t> data;
+    size_t pos = 0;
+    bool open = false;
+    bool ok = true;
+    ReplayHeader header{};
+
+    uint32_t U8() {
+        if (pos >= data.size()) { ok = false; return 0; }
+        return data[pos++];
+    }
+    uint32_t U16() { uint32_t lo = U8(); return lo | (U8() << 8); }
+    uint32_t Varint() {
+        uint32_t v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            uint32_t b = U8();
+            v |= (b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+        }
+        return v;
+    }
+};
@@ -0,0 +1,163 @@
+#pragma once
+// Session snapshot: settings, sound toggles and the match in progress, in one
+// fixed-size binary record (session.snap). The game hands a copy to
+// SnapshotWriter on every screen change and every guess; a background thread
+// writes the latest one to a temp file and swaps it into place, so the file
+// is always either the old or the new snapshot, never half of one.
+//
+// At launch the file is mapped, checked (magic, version, size, checksum) and
+// copied out: a few hundred bytes, no parsing. Leaderboard totals are not
+// part of it; leaderboard_store.h already persists those on every score.
+#include "hangman_rules.h"
+#include "mapped_file.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+static const char SNAPSHOT_FILE[] = "session.snap";
+static const char SNAPSHOT_MAGIC[4] = { 'H', 'G', 'S', 'S' };
+static const uint16_t SNAPSHOT_VERSION = 2; // 2: LATIN letter indices changed
+
+struct SessionSnapshot {
+    char magic[4];
+    uint16_t version;
+    uint16_t size;          // sizeof(SessionSnapshot), catches layout changes
+    uint32_t checksum;      // FNV-1a of everything after this field
+
+    // Settings
+    char player1[NameString::CAPACITY + 1];
+    char player2[NameString::CAPACITY + 1];
+    uint8_t totalRounds;
+    uint8_t maxLives;
+    uint16_t timeLimit;
+    uint8_t flags;          // SNAP_* bits
+    uint8_t alphabet;       // AlphabetId
+    uint8_t scoring;        // ScoringRule
+    uint8_t rival;          // RivalMode
+    uint8_t difficulty;     // WordDifficulty
+
+    // Match (valid when SNAP_IN_MATCH is set)
+    uint8_t screen;         // GameScreen to resume on
+    uint8_t currentRound;
+    uint8_t lives;
+    uint16_t player1Score;
+    uint16_t player2Score;
+    float timeLeft;
+    uint64_t triedMask;
+    char secretWord[WordString::CAPACITY + 1];   // empty while the word is being entered
+    char hint[HintString::CAPACITY + 1];
+};
+
+enum SnapshotFlags : uint8_t {
+    SNAP_SOUND        = 1 << 0,
+    SNAP_MUSIC        = 1 << 1,
+    SNAP_STARTER_P1   = 1 << 2,
+    SNAP_SWAP_ROLES   = 1 << 3,
+    SNAP_IN_MATCH     = 1 << 4,
+    SNAP_P1_IS_SETTER = 1 << 5,
+    SNAP_ROUND_OVER   = 1 << 6,
+    SNAP_ROUND_WON    = 1 << 7
+};
+
+inline uint32_t SnapshotChecksum(const SessionSnapshot& s) {
+    const unsigned char* p = (const unsigned char*)&s + offsetof(SessionSnapshot, checksum) + sizeof(s.checksum);
+    const unsigned char* end = (const unsigned char*)&s + sizeof(s);
+    uint32_t h = 2166136261u;
+    for (; p < end; ++p) h = (h ^ *p) * 16777619u;
+    return h;
+}
+
+// Start every snapshot from this: zeroes the padding too, so equal state
+// always gives equal bytes (and checksum)
+inline void ClearSnapshot(SessionSnapshot& s) {
+    std::memset(&s, 0, sizeof(s));
+}
+
+// Fills in the header; call once the rest is written
+inline void SealSnapshot(SessionSnapshot& s) {
+    std::memcpy(s.magic, SNAPSHOT_MAGIC, 4);
+    s.version = SNAPSHOT_VERSION;
+    s.size = (uint16_t)sizeof(SessionSnapshot);
+    s.checksum = SnapshotChecksum(s);
+}
+
+// False if there is no snapshot or it is from another version / damaged
+inline bool LoadSnapshot(const char* path, SessionSnapshot& out) {
+    MappedFile file;
+    if (!file.Open(path) || file.Size() != sizeof(SessionSnapshot)) return false;
+    std::memcpy(&out, file.Data(), sizeof(out));
+    return std::memcmp(out.magic, SNAPSHOT_MAGIC, 4) == 0 && out.version == SNAPSHOT_VERSION &&
+           out.size == sizeof(SessionSnapshot) && out.checksum == SnapshotChecksum(out);
+}
+
+// NUL-terminated copy into a (cleared) snapshot field
+template <size_t N>
+inline void SnapshotString(char (&field)[N], std::string_view s) {
+    std::memcpy(field, s.data(), s.size() < N - 1 ? s.size() : N - 1);
+}
+
+// One background thread; Submit() only copies into the pending slot, so a
+// burst of snapshots collapses into one write of the latest
+class SnapshotWriter {
+public:
+    ~SnapshotWriter() { Shutdown(); }
+
+    void Start(const char* filePath) {
+        if (thread.joinable()) return;
+        path = filePath;
+        running = true;
+        thread = std::thread([this] { WriteLoop(); });
+    }
+
+    void Submit(const SessionSnapshot& s) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            pending = s;
+            hasPending = true;
+        }
+        wake.notify_one();
+    }
+
+    // Writes whatever is still pending, then stops the thread
+    void Shutdown() {
+        if (!thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        wake.notify_one();
+        thread.join();
+    }
+
+    uint64_t Writes() const { return writes; }
+    uint64_t Failures() const { return failures; }
+
+private:
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable wake;
+    const char* path = SNAPSHOT_FILE;
+    SessionSnapshot pending{};
+    bool hasPending = false;
+    bool running = false;
+    uint64_t writes = 0;     // written by the thread, read after Shutdown
+    uint64_t failures = 0;
+
+    void WriteLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wake.wait(lock, [this] { return hasPending || !running; });
+            if (!hasPending) break; // stopping and nothing left
+
+            SessionSnapshot s = pending;
+            hasPending = false;
+            lock.unlock();
+            if (WriteFileAtomic(path, &s, sizeof(s))) writes++;
+            else failures++;
+            lock.lock();
+        }
+    }
+};
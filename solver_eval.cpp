@@ -0,0 +1,138 @@
+// Solver evaluation: the computer guesser plays every word of words.dict
+// through the game's rules, on all cores, and reports how it does for
+// each lives setting (maxLivesSetting 1..7) plus throughput.
+//
+// The solver never looks at the lives left, so its guess sequence for a word
+// is the same under every setting. Each word is therefore played once with
+// lives to spare and the miss count decides the result for every setting:
+// with L lives the round is won iff it finishes with fewer than L misses.
+//
+// Usage: solver_eval [words.dict] [--threads N] [--limit N] [--every K]
+//   --limit N   only the first N words     --every K   every K-th word
+#include "hangman_rules.h"
+#include "hangman_solver.h"
+#include "work_stealing_pool.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using std::string;
+using std::vector;
+
+static const int MAX_LIVES = 7;
+static const size_t GRAIN = 64; // words per stealable chunk
+
+struct EvalStats {
+    unsigned long long words = 0;
+    unsigned long long guesses = 0;
+    unsigned long long wins[MAX_LIVES + 1] = {};  // by lives setting
+    unsigned long long wrong[MAX_LIVES + 1] = {}; // wrong guesses made under that setting
+
+    void Merge(const EvalStats& o) {
+        words += o.words;
+        guesses += o.guesses;
+        for (int l = 1; l <= MAX_LIVES; ++l) {
+            wins[l] += o.wins[l];
+            wrong[l] += o.wrong[l];
+        }
+    }
+};
+
+// Padded so per-thread counters never share a cache line
+struct alignas(64) WorkerSlot {
+    EvalStats stats;
+};
+
+int main(int argc, char** argv) {
+    const char* path = "words.dict";
+    int threads = 0;
+    size_t limit = 0;
+    size_t every = 1;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--limit") == 0 && i + 1 < argc) limit = (size_t)std::atoll(argv[++i]);
+        else if (std::strcmp(argv[i], "--every") == 0 && i + 1 < argc) every = (size_t)std::atoll(argv[++i]);
+        else path = argv[i];
+    }
+    if (every < 1) every = 1;
+
+    WordDictionary dict;
+    if (!dict.Open(path)) {
+        std::fprintf(stderr, "cannot open %s (build it with dict_builder)\n", path);
+        return 1;
+    }
+
+    // Shared, read-only once built
+    PackedLexicon lexicon(dict);
+    lexicon.BuildAll();
+
+    // Flat index over all lengths: word k lives in length bucket lenOf(k)
+    vector<size_t> firstOfLen(DICT_MAX_LEN + 2, 0);
+    for (int len = 1; len <= DICT_MAX_LEN; ++len) {
+        firstOfLen[len + 1] = firstOfLen[len] + lexicon.Get(len).rows.size();
+    }
+    size_t total = firstOfLen[DICT_MAX_LEN + 1];
+    size_t count = (total + every - 1) / every;
+    if (limit > 0 && limit < count) count = limit;
+
+    WorkStealingPool pool(threads);
+    vector<WorkerSlot> slots(pool.Workers());
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    pool.ParallelFor(count, GRAIN, [&](int worker, size_t begin, size_t end) {
+        // Solver scratch is per chunk; the lexicon is shared
+        HangmanSolver solver(lexicon);
+        // Untimed, and 26 lives so every word is played out to the end
+        BasicMatch<ClassicScoring, NoTimer, FixedLives<26>> match;
+        EvalStats& s = slots[worker].stats;
+        string word;
+
+        int len = 1;
+        for (size_t k = begin; k < end; ++k) {
+            size_t flat = k * every;
+            while (flat >= firstOfLen[len + 1]) len++;
+            const PackedWord& row = lexicon.Get(len).rows[flat - firstOfLen[len]];
+            word.assign(row.c, len);
+
+            match.StartRound(word, "eval");
+            solver.Reset();
+            while (!match.gameOver) {
+                char g = solver.NextGuess(match.shownWord, (uint32_t)match.letters.triedMask);
+                if (g == 0) break;
+                match.ProcessGuess(g);
+                s.guesses++;
+            }
+
+            int misses = match.lives;
+            for (int l = 1; l <= MAX_LIVES; ++l) {
+                bool won = match.win && misses < l;
+                if (won) s.wins[l]++;
+                s.wrong[l] += won ? misses : l;
+            }
+            s.words++;
+        }
+    });
+
+    auto t1 = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    if (secs <= 0.0) secs = 1e-9;
+
+    EvalStats all;
+    for (const WorkerSlot& w : slots) all.Merge(w.stats);
+
+    std::printf("dictionary:  %s (%zu words, %zu evaluated)\n", path, total, (size_t)all.words);
+    std::printf("threads:     %d (%zu chunks stolen)\n", pool.Workers(), pool.Steals());
+    std::printf("\nlives  win rate  avg wrong\n");
+    for (int l = 1; l <= MAX_LIVES; ++l) {
+        double n = all.words ? (double)all.words : 1.0;
+        std::printf("%5d  %7.2f%%  %9.3f\n", l, 100.0 * all.wins[l] / n, all.wrong[l] / n);
+    }
+    std::printf("\nguesses:     %llu\n", all.guesses);
+    std::printf("elapsed:     %.3f s\n", secs);
+    std::printf("words/sec:   %.0f\n", all.words / secs);
+    return 0;
+}
@@ -0,0 +1,247 @@
+#pragma once
+// Gameplay and performance telemetry, written as newline-delimited JSON.
+//
+// The frame loop only fills a small POD event and pushes it into a lock-free
+// single-producer/single-consumer ring (no lock, no allocation, no I/O; a
+// full ring drops the event and counts it). A background thread wakes every
+// FLUSH_INTERVAL_MS, drains the ring, formats the batch and appends it to the
+// file with one fwrite. At shutdown it adds a summary line: events dropped and
+// the wrong-guess distribution of finished rounds per lives setting.
+//
+// Off unless --telemetry <file> is given. Kept free of raylib like the rules.
+#include "hangman_rules.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct TelemetryOptions {
+    const char* path = nullptr;
+
+    void ParseArgs(int argc, char** argv) {
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--telemetry") == 0) path = argv[++i];
+        }
+    }
+};
+
+enum class TelemetryKind : uint8_t {
+    MATCH_START,  // a series begins
+    GUESS,        // one accepted guess
+    ROUND_END,    // round decided (AwardScore ran)
+    FRAMES,       // frame-time percentiles over the last window
+    ASSET_LOAD,   // an asset finished loading on the worker
+    COUNT
+};
+
+// One record; which fields mean something depends on kind
+struct TelemetryEvent {
+    TelemetryKind kind = TelemetryKind::GUESS;
+    uint8_t result = 0;      // GUESS: GuessResult   ROUND_END: 1 = guesser won
+    uint8_t maxLives = 0;    // lives setting in force
+    uint8_t wrong = 0;       // wrong guesses so far (GUESS) / in the round (ROUND_END)
+    uint8_t round = 0;
+    int8_t setterAward = 0;  // ROUND_END: points AwardScore gave
+    int8_t guesserAward = 0;
+    uint8_t timedOut = 0;    // ROUND_END: the clock ran out
+    uint32_t code = 0;       // GUESS: letter   MATCH_START: total rounds   FRAMES: frames
+    float value[6] = {};     // GUESS: [0] ms since the previous guess (or round start)
+                             // FRAMES: frame p50/p99/max, CPU p50/p99/max (ms)
+                             // ASSET_LOAD: [0] ms   MATCH_START: [0] time limit (s)
+    double time = 0.0;       // game clock, seconds
+    const char* label = nullptr; // static strings only: asset / alphabet name
+    const char* label2 = nullptr; // MATCH_START: scoring rule
+};
+
+// Fixed-capacity SPSC queue (N a power of two): Push from one thread only,
+// Pop from one other thread only
+template <class T, uint32_t N>
+class SpscRing {
+public:
+    static_assert((N & (N - 1)) == 0, "capacity must be a power of two");
+
+    bool Push(const T& item) {
+        uint32_t w = writePos.load(std::memory_order_relaxed);
+        if (w - readPos.load(std::memory_order_acquire) == N) return false;
+        items[w & (N - 1)] = item;
+        writePos.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool Pop(T& out) {
+        uint32_t r = readPos.load(std::memory_order_relaxed);
+        if (r == writePos.load(std::memory_order_acquire)) return false;
+        out = items[r & (N - 1)];
+        readPos.store(r + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items[N];
+    alignas(64) std::atomic<uint32_t> writePos{ 0 }; // free-running counters,
+    alignas(64) std::atomic<uint32_t> readPos{ 0 };  // on their own cache lines
+};
+
+class TelemetrySink {
+public:
+    static const uint32_t RING_CAPACITY = 512;   // ~2 s of a busy frame loop between flushes
+    static const int FLUSH_INTERVAL_MS = 250;
+
+    ~TelemetrySink() { Shutdown(); }
+
+    bool Start(const char* path) {
+        if (file != nullptr) return true;
+        file = std::fopen(path, "ab");
+        if (file == nullptr) return false;
+        running = true;
+        thread = std::thread([this] { WriteLoop(); });
+        return true;
+    }
+
+    bool Active() const { return file != nullptr; }
+
+    // Frame loop only. Never blocks: a full ring drops the event.
+    void Record(const TelemetryEvent& e) {
+        if (file == nullptr) return;
+        if (ring.Push(e)) recorded++;
+        else dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Flushes what is queued, writes the summary and closes the file
+    void Shutdown() {
+        if (!thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        wake.notify_one();
+        thread.join();
+        std::fclose(file);
+        file = nullptr;
+    }
+
+    uint64_t Recorded() const { return recorded; }
+    uint64_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    static const int MAX_LIVES = RuntimeLives::MAX_LIVES;
+
+    SpscRing<TelemetryEvent, RING_CAPACITY> ring;
+    FILE* file = nullptr;
+    std::thread thread;
+    std::mutex mutex;          // only between Shutdown and the writer, never Record
+    std::condition_variable wake;
+    bool running = false;
+    uint64_t recorded = 0;     // frame loop only
+    std::atomic<uint64_t> dropped{ 0 };
+
+    // Writer thread only: rounds by lives setting and wrong guesses made
+    uint64_t wrongByLives[MAX_LIVES + 1][MAX_LIVES + 1] = {};
+    std::string batch;
+
+    void WriteLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            bool stop = !running;
+            lock.unlock();
+            Drain();
+            lock.lock();
+            if (stop) break;
+            wake.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS), [this] { return !running; });
+        }
+        lock.unlock();
+        WriteSummary();
+    }
+
+    void Drain() {
+        batch.clear();
+        TelemetryEvent e;
+        while (ring.Pop(e)) Format(e);
+        Flush();
+    }
+
+    void Flush() {
+        if (batch.empty()) return;
+        std::fwrite(batch.data(), 1, batch.size(), file);
+        std::fflush(file);
+    }
+
+    void Format(const TelemetryEvent& e) {
+        char line[320];
+        int n = 0;
+        switch (e.kind) {
+            case TelemetryKind::MATCH_START:
+                n = std::snprintf(line, sizeof(line),
+                                  "{\"t\":%.3f,\"ev\":\"match_start\",\"rounds\":%u,\"max_lives\":%d,"
+                                  "\"time_limit\":%.0f,\"alphabet\":\"%s\",\"scoring\":\"%s\"}\n",
+                                  e.time, e.code, e.maxLives, e.value[0], e.label ? e.label : "",
+                                  e.label2 ? e.label2 : "");
+                break;
+            case TelemetryKind::GUESS: {
+                static const char* const RESULTS[] = { "tried", "hit", "miss", "won", "lost" };
+                FixedString<4> letter;
+                Utf8Append(letter, e.code);
+                n = std::snprintf(line, sizeof(line),
+                                  "{\"t\":%.3f,\"ev\":\"guess\",\"round\":%d,\"letter\":\"%s\",\"result\":\"%s\","
+                                  "\"ms\":%.1f,\"wrong\":%d,\"max_lives\":%d}\n",
+                                  e.time, e.round, letter.c_str(), RESULTS[e.result < 5 ? e.result : 0], e.value[0],
+                                  e.wrong, e.maxLives);
+                break;
+            }
+            case TelemetryKind::ROUND_END:
+                if (e.maxLives <= MAX_LIVES && e.wrong <= MAX_LIVES) wrongByLives[e.maxLives][e.wrong]++;
+                n = std::snprintf(line, sizeof(line),
+                                  "{\"t\":%.3f,\"ev\":\"round_end\",\"round\":%d,\"won\":%s,\"timed_out\":%s,"
+                                  "\"wrong\":%d,\"max_lives\":%d,\"setter_award\":%d,\"guesser_award\":%d}\n",
+                                  e.time, e.round, e.result ? "true" : "false", e.timedOut ? "true" : "false",
+                                  e.wrong, e.maxLives, e.setterAward, e.guesserAward);
+                break;
+            case TelemetryKind::FRAMES:
+                n = std::snprintf(line, sizeof(line),
+                                  "{\"t\":%.3f,\"ev\":\"frames\",\"frames\":%u,"
+                                  "\"frame_ms\":{\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f},"
+                                  "\"cpu_ms\":{\"p50\":%.2f,\"p99\":%.2f,\"max\":%.2f}}\n",
+                                  e.time, e.code, e.value[0], e.value[1], e.value[2], e.value[3], e.value[4],
+                                  e.value[5]);
+                break;
+            case TelemetryKind::ASSET_LOAD:
+                n = std::snprintf(line, sizeof(line), "{\"t\":%.3f,\"ev\":\"asset_load\",\"asset\":\"%s\",\"ms\":%.2f}\n",
+                                  e.time, e.label ? e.label : "", e.value[0]);
+                break;
+            case TelemetryKind::COUNT:
+                break;
+        }
+        if (n > 0) batch.append(line, (size_t)std::min(n, (int)sizeof(line) - 1));
+    }
+
+    // {"ev":"summary","dropped":N,"wrong_guesses":{"<lives>":[rounds with 0..lives wrong],...}}
+    void WriteSummary() {
+        batch.clear();
+        char buf[64];
+        std::snprintf(buf, sizeof(buf), "{\"ev\":\"summary\",\"dropped\":%llu,\"wrong_guesses\":{",
+                      (unsigned long long)Dropped());
+        batch += buf;
+        bool first = true;
+        for (int lives = 1; lives <= MAX_LIVES; ++lives) {
+            uint64_t rounds = 0;
+            for (int w = 0; w <= lives; ++w) rounds += wrongByLives[lives][w];
+            if (rounds == 0) continue;
+            std::snprintf(buf, sizeof(buf), "%s\"%d\":[", first ? "" : ",", lives);
+            batch += buf;
+            for (int w = 0; w <= lives; ++w) {
+                std::snprintf(buf, sizeof(buf), "%s%llu", w ? "," : "", (unsigned long long)wrongByLives[lives][w]);
+                batch += buf;
+            }
+            batch += "]";
+            first = false;
+        }
+        batch += "}}\n";
+        Flush();
+    }
+};
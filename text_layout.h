@@ -0,0 +1,121 @@
+#pragma once
+// Text layout cache: remembers MeasureTextEx results (and per-glyph pen
+// positions) for each (text, font size, spacing) so the static labels drawn
+// every frame are measured once instead of once per frame.
+#include "raylib.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct TextLayout {
+    Vector2 size{};                 // same as MeasureTextEx
+    std::vector<float> glyphX;      // pen x of each glyph, plus the end position
+};
+
+class TextLayoutCache {
+public:
+    static const int CAPACITY = 256; // entries; table is cleared when full
+
+    unsigned long long hits = 0;
+    unsigned long long misses = 0;
+
+    void SetFont(Font f) {
+        font = f;
+        Clear();
+    }
+
+    void Clear() {
+        for (Entry& e : table) e.used = false;
+        count = 0;
+    }
+
+    const TextLayout& Get(const char* text, float fontSize, float spacing) {
+        uint64_t h = Hash(text, fontSize, spacing);
+        int slot = (int)(h % CAPACITY);
+
+        for (int probe = 0; probe < CAPACITY; ++probe) {
+            Entry& e = table[slot];
+            if (!e.used) break;
+            if (e.hash == h && e.fontSize == fontSize && e.spacing == spacing &&
+                e.text == text) {
+                hits++;
+                return e.layout;
+            }
+            slot = (slot + 1) % CAPACITY;
+        }
+
+        misses++;
+        if (count >= CAPACITY * 3 / 4) {
+            // Mostly dynamic text got us here: start over rather than probe forever
+            Clear();
+            slot = (int)(h % CAPACITY);
+        }
+        while (table[slot].used) slot = (slot + 1) % CAPACITY;
+
+        Entry& e = table[slot];
+        e.used = true;
+        e.hash = h;
+        e.fontSize = fontSize;
+        e.spacing = spacing;
+        e.text = text;
+        Build(e.layout, text, fontSize, spacing);
+        count++;
+        return e.layout;
+    }
+
+    Vector2 Measure(const char* text, float fontSize, float spacing) {
+        return Get(text, fontSize, spacing).size;
+    }
+
+private:
+    struct Entry {
+        bool used = false;
+        uint64_t hash = 0;
+        float fontSize = 0.0f;
+        float spacing = 0.0f;
+        std::string text;
+        TextLayout layout;
+    };
+
+    Font font{};
+    Entry table[CAPACITY];
+    int count = 0;
+
+    static uint64_t Hash(const char* text, float fontSize, float spacing) {
+        uint64_t h = 1469598103934665603ull; // FNV-1a
+        for (const unsigned char* p = (const unsigned char*)text; *p; ++p) {
+            h = (h ^ *p) * 1099511628211ull;
+        }
+        uint32_t bits[2];
+        std::memcpy(&bits[0], &fontSize, sizeof(float));
+        std::memcpy(&bits[1], &spacing, sizeof(float));
+        h = (h ^ bits[0]) * 1099511628211ull;
+        h = (h ^ bits[1]) * 1099511628211ull;
+        return h;
+    }
+
+    // Pen positions follow DrawTextEx's advance rules
+    void Build(TextLayout& out, const char* text, float fontSize, float spacing) {
+        out.size = MeasureTextEx(font, text, fontSize, spacing);
+        out.glyphX.clear();
+
+        float scale = fontSize / (float)font.baseSize;
+        float penX = 0.0f;
+        int i = 0;
+        int len = (int)std::strlen(text);
+        while (i < len) {
+            int bytes = 0;
+            int codepoint = GetCodepointNext(&text[i], &bytes);
+            int index = GetGlyphIndex(font, codepoint);
+            out.glyphX.push_back(penX);
+
+            float advance = (font.glyphs[index].advanceX == 0)
+                ? font.recs[index].width
+                : (float)font.glyphs[index].advanceX;
+            penX += advance * scale + spacing;
+            i += bytes;
+        }
+        out.glyphX.push_back(penX);
+    }
+};
@@ -0,0 +1,141 @@
+#pragma once
+// Hierarchical timer wheel: 4 levels of 64 slots. Level 0 holds timers due
+// in the next 64 ticks, level 1 the next 64^2, and so on; when the level-0
+// hand wraps, the next level's current slot is cascaded down. Schedule and
+// cancel are O(1), and advancing a tick only touches the timers that are
+// due, however many rooms have a clock running.
+//
+// Timers live in a node pool and are referenced by handles carrying a
+// generation, so cancelling one that already fired is harmless.
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class TimerWheel {
+public:
+    typedef uint64_t Handle;
+    static const Handle NONE = 0;
+
+    explicit TimerWheel(uint64_t startTick = 0) : now(startTick) {
+        for (int l = 0; l < LEVELS; ++l)
+            for (int s = 0; s < SLOTS; ++s) heads[l][s] = NIL;
+    }
+
+    uint64_t Now() const { return now; }
+    size_t Pending() const { return active; }
+
+    // Fires fn(data) once Advance reaches dueTick (at least one tick from now)
+    Handle Schedule(uint64_t dueTick, uint64_t data) {
+        uint32_t i;
+        if (freeHead != NIL) {
+            i = freeHead;
+            freeHead = nodes[i].next;
+        } else {
+            i = (uint32_t)nodes.size();
+            nodes.push_back(Node{});
+        }
+        Node& n = nodes[i];
+        n.due = dueTick <= now ? now + 1 : dueTick;
+        n.data = data;
+        n.gen++;
+        n.live = true;
+        Insert(i);
+        active++;
+        return ((Handle)n.gen << 32) | (i + 1);
+    }
+
+    void Cancel(Handle h) {
+        if (h == NONE) return;
+        uint32_t i = (uint32_t)(h & 0xFFFFFFFFu) - 1;
+        if (i >= nodes.size()) return;
+        Node& n = nodes[i];
+        if (!n.live || n.gen != (uint32_t)(h >> 32)) return;
+        Unlink(i);
+        Release(i);
+    }
+
+    // Moves the clock to nowTick, firing everything due on the way (in order)
+    template <class Fn>
+    void Advance(uint64_t nowTick, Fn fn) {
+        while (now < nowTick) {
+            now++;
+
+            // Cascade: each level's hand moves when the one below wraps
+            for (int l = 1; l < LEVELS; ++l) {
+                if ((now & ((1ull << (SLOT_BITS * l)) - 1)) != 0) break;
+                int s = (int)((now >> (SLOT_BITS * l)) & (SLOTS - 1));
+                uint32_t i = heads[l][s];
+                heads[l][s] = NIL;
+                while (i != NIL) {
+                    uint32_t next = nodes[i].next;
+                    Insert(i); // lands on a lower level (or a later slot of this one)
+                    i = next;
+                }
+            }
+
+            // Unlink one at a time: fn may cancel or add timers in this slot's list
+            int s = (int)(now & (SLOTS - 1));
+            uint32_t i;
+            while ((i = heads[0][s]) != NIL) {
+                uint64_t data = nodes[i].data;
+                Unlink(i);
+                Release(i);
+                fn(data);
+            }
+        }
+    }
+
+private:
+    static const int LEVELS = 4;
+    static const int SLOT_BITS = 6;
+    static const int SLOTS = 1 << SLOT_BITS;
+    static const uint32_t NIL = 0xFFFFFFFFu;
+
+    struct Node {
+        uint64_t due = 0;
+        uint64_t data = 0;
+        uint32_t prev = NIL, next = NIL;
+        uint32_t gen = 0;
+        uint8_t level = 0, slot = 0;
+        bool live = false;
+    };
+
+    uint64_t now;
+    size_t active = 0;
+    std::vector<Node> nodes;
+    uint32_t freeHead = NIL;
+    uint32_t heads[LEVELS][SLOTS];
+
+    void Insert(uint32_t i) {
+        Node& n = nodes[i];
+        uint64_t delta = n.due - now;
+        int level = 0;
+        while (level < LEVELS - 1 && delta >= (1ull << (SLOT_BITS * (level + 1)))) level++;
+        uint64_t due = n.due;
+        // Beyond the top level's span: park in its furthest slot and re-cascade
+        uint64_t span = 1ull << (SLOT_BITS * LEVELS);
+        if (delta >= span) due = now + span - 1;
+
+        n.level = (uint8_t)level;
+        n.slot = (uint8_t)((due >> (SLOT_BITS * level)) & (SLOTS - 1));
+        n.prev = NIL;
+        n.next = heads[level][n.slot];
+        if (n.next != NIL) nodes[n.next].prev = i;
+        heads[level][n.slot] = i;
+    }
+
+    void Unlink(uint32_t i) {
+        Node& n = nodes[i];
+        if (n.prev != NIL) nodes[n.prev].next = n.next;
+        else heads[n.level][n.slot] = n.next;
+        if (n.next != NIL) nodes[n.next].prev = n.prev;
+    }
+
+    void Release(uint32_t i) {
+        Node& n = nodes[i];
+        n.live = false;
+        n.next = freeHead;
+        freeHead = i;
+        active--;
+    }
+};
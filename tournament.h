@@ -0,0 +1,414 @@
+#pragma once
+// Tournament mode: up to MAX_PLAYERS players in a single-elimination bracket,
+// every pairing a full series under the game's rules.
+//
+// Matches between two computer players are played headless (BasicMatch plus
+// the solver, no clock) by a set of worker threads that take READY matches
+// straight from the bracket. Finishing a match wakes the workers, so its
+// successor starts as soon as both of its players are known and later rounds
+// overlap with slow earlier ones; there is no per-round barrier. Matches with a human player go
+// to the kiosk: the game plays them as an ordinary hot-seat or vs-computer
+// series on this machine and reports the scores back.
+//
+// The game thread never waits on the workers: it takes finished scores and a
+// copy of the bracket with try_lock and simply tries again next frame.
+//
+// Kept free of raylib (like hangman_rules.h).
+#include "hangman_rules.h"
+#include "hangman_solver.h"
+#include "word_dict.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct TournamentOptions {
+    static const int MAX_PLAYERS = 64;
+
+    int size = 0;                    // --tournament N: seats; computer players fill the ones left
+    std::vector<std::string> humans; // --kiosk NAME (repeatable): players at this machine
+    int threads = 0;                 // --tournament-threads N (0 = every core)
+
+    void ParseArgs(int argc, char** argv) {
+        for (int i = 1; i + 1 < argc; ++i) {
+            if (std::strcmp(argv[i], "--tournament") == 0) size = std::atoi(argv[++i]);
+            else if (std::strcmp(argv[i], "--kiosk") == 0) humans.push_back(argv[++i]);
+            else if (std::strcmp(argv[i], "--tournament-threads") == 0) threads = std::atoi(argv[++i]);
+        }
+        if (size > MAX_PLAYERS) size = MAX_PLAYERS;
+        if ((int)humans.size() > MAX_PLAYERS) humans.resize(MAX_PLAYERS);
+    }
+
+    bool Enabled() const { return size > 0 || !humans.empty(); }
+};
+
+struct TournamentPlayer {
+    NameString name;
+    bool human = false;
+};
+
+enum class BracketState : uint8_t {
+    WAITING,  // a player is still to be decided
+    READY,
+    RUNNING,
+    DONE
+};
+
+struct BracketMatch {
+    int a = -1, b = -1;       // player (= seed) indices, -1 until known
+    int scoreA = 0, scoreB = 0;
+    int winner = -1;
+    BracketState state = BracketState::WAITING;
+    bool bye = false;         // one player only: through without playing
+};
+
+// Single elimination over a power-of-two field. Round r holds Field() >> (r + 1)
+// matches, stored after those of the earlier rounds; the last match is the final.
+// Seeds are paired 1 v N, 2 v N-1, ... arranged so the top seeds meet last,
+// and the empty seats (byes) all face top seeds. A drawn series goes to the
+// higher seed.
+class Bracket {
+public:
+    void Seed(int playerCount) {
+        field = 2;
+        rounds = 1;
+        while (field < playerCount) {
+            field <<= 1;
+            rounds++;
+        }
+        matches.assign((size_t)field - 1, BracketMatch{});
+
+        // Seed order: [0, 1] -> [0, 3, 1, 2] -> [0, 7, 3, 4, 1, 6, 2, 5] ...
+        std::vector<int> order{ 0, 1 };
+        for (int n = 2; n < field; n <<= 1) {
+            std::vector<int> next;
+            for (int s : order) {
+                next.push_back(s);
+                next.push_back(2 * n - 1 - s);
+            }
+            order.swap(next);
+        }
+
+        for (int i = 0; i < field / 2; ++i) {
+            BracketMatch& m = matches[i];
+            m.a = order[2 * i] < playerCount ? order[2 * i] : -1;
+            m.b = order[2 * i + 1] < playerCount ? order[2 * i + 1] : -1;
+            if (m.a >= 0 && m.b >= 0) {
+                m.state = BracketState::READY;
+            } else {
+                m.bye = true;
+                m.winner = m.a >= 0 ? m.a : m.b;
+                m.state = BracketState::DONE;
+                Advance(i);
+            }
+        }
+    }
+
+    int Field() const { return field; }
+    int Rounds() const { return rounds; }
+    int MatchCount() const { return (int)matches.size(); }
+    int First(int round) const { return field - (field >> round); }
+    int CountIn(int round) const { return field >> (round + 1); }
+    int RoundOf(int match) const {
+        int r = 0;
+        while (match >= First(r + 1)) r++;
+        return r;
+    }
+
+    const BracketMatch& At(int match) const { return matches[match]; }
+    BracketMatch& At(int match) { return matches[match]; }
+    const std::vector<BracketMatch>& Matches() const { return matches; }
+
+    void Report(int match, int scoreA, int scoreB) {
+        BracketMatch& m = matches[match];
+        m.scoreA = scoreA;
+        m.scoreB = scoreB;
+        if (scoreA != scoreB) m.winner = scoreA > scoreB ? m.a : m.b;
+        else m.winner = m.a < m.b ? m.a : m.b;
+        m.state = BracketState::DONE;
+        Advance(match);
+    }
+
+    bool Finished() const { return !matches.empty() && matches.back().state == BracketState::DONE; }
+    int Champion() const { return Finished() ? matches.back().winner : -1; }
+
+private:
+    int field = 0;
+    int rounds = 0;
+    std::vector<BracketMatch> matches;
+
+    void Advance(int match) {
+        int r = RoundOf(match);
+        if (r + 1 >= rounds) return;
+        int i = match - First(r);
+        BracketMatch& next = matches[First(r + 1) + i / 2];
+        int& slot = (i % 2 == 0) ? next.a : next.b;
+        slot = matches[match].winner;
+        if (next.a >= 0 && next.b >= 0) next.state = BracketState::READY;
+    }
+};
+
+// Untimed: the solver answers instantly, so a clock would never matter
+using TournamentRules = BasicMatch<RuntimeScoring, NoTimer, RuntimeLives>;
+
+// One series between two computer players (A is player 1): words from the
+// dictionary, guesses from the solver. Scores end up in match.
+inline void PlayComputerSeries(TournamentRules& match, const WordDictionary& dict, HangmanSolver& solver,
+                               std::mt19937_64& rng) {
+    match.StartMatch();
+    for (;;) {
+        char word[DICT_MAX_LEN + 1];
+        if (!dict.Pick(DictQuery{}, rng, word)) return;
+        match.StartRound(word, "");
+        solver.Reset();
+        while (!match.gameOver) {
+            char g = solver.NextGuess(match.shownWord, (uint32_t)match.letters.triedMask);
+            if (g == 0) {
+                match.TimeOut(); // out of letters: can't happen with a dictionary word
+                break;
+            }
+            match.ProcessGuess(g);
+        }
+        if (!match.AdvanceRound()) return;
+    }
+}
+
+// A player's final score from one tournament series, for the leaderboard
+struct TournamentScore {
+    NameString name;
+    int score = 0;
+};
+
+// A kiosk match handed to the game
+struct KioskMatch {
+    int match = -1;
+    TournamentPlayer a, b;
+};
+
+// What the bracket screen draws; copied out under the lock
+struct TournamentView {
+    uint64_t version = 0;
+    int rounds = 0;
+    int field = 0;
+    int running = 0;     // computer matches being played right now
+    int champion = -1;
+    std::vector<TournamentPlayer> players;
+    std::vector<BracketMatch> matches;
+};
+
+class TournamentRunner {
+public:
+    ~TournamentRunner() { Shutdown(); }
+
+    bool Active() const { return thread.joinable(); }
+
+    // Seats the players (kiosk humans first, as the top seeds) and starts the
+    // workers. Computer matches use rules with swapped roles and the
+    // English alphabet (the solver's).
+    void Start(const TournamentOptions& opts, const MatchSettings& rules, const WordDictionary& dict, uint64_t seed) {
+        if (Active()) return;
+        settings = rules;
+        settings.swapRoles = true;
+        settings.alphabet = AlphabetId::ENGLISH;
+        dictionary = &dict;
+        baseSeed = seed;
+        threads = opts.threads;
+
+        players.clear();
+        for (const std::string& h : opts.humans) {
+            TournamentPlayer p;
+            p.name = h; // cut to NAME_MAX_CHARS
+            p.human = true;
+            players.push_back(p);
+        }
+        int seats = std::max(std::max(opts.size, (int)players.size()), 2);
+        for (int cpu = 1; (int)players.size() < seats; ++cpu) {
+            char name[NAME_MAX_CHARS + 1];
+            std::snprintf(name, sizeof(name), "CPU %d", cpu);
+            TournamentPlayer p;
+            p.name = name;
+            players.push_back(p);
+        }
+        bracket.Seed((int)players.size());
+
+        stopping = false;
+        version = 1;
+        thread = std::thread([this] { Run(); });
+    }
+
+    // Stops after the computer matches in flight; the bracket is not saved
+    void Shutdown() {
+        if (!thread.joinable()) return;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        thread.join();
+    }
+
+    // ---- game thread ----
+
+    // The next kiosk match whose players are known (marked as running)
+    bool TakeKioskMatch(KioskMatch& out) {
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock()) return false;
+        for (int m = 0; m < bracket.MatchCount(); ++m) {
+            BracketMatch& bm = bracket.At(m);
+            if (bm.state != BracketState::READY || !IsKiosk(bm)) continue;
+            bm.state = BracketState::RUNNING;
+            version++;
+            out.match = m;
+            out.a = players[bm.a];
+            out.b = players[bm.b];
+            UpdateKioskReady();
+            return true;
+        }
+        return false;
+    }
+
+    // Is a kiosk match waiting (for the screen's PLAY button)
+    bool KioskWaiting() const { return kioskReady.load(std::memory_order_relaxed); }
+
+    void ReportKiosk(int match, int scoreA, int scoreB) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            Finish(match, scoreA, scoreB);
+        }
+        wake.notify_all();
+    }
+
+    // Kiosk match abandoned: back in the kiosk queue (workers never take it)
+    void ReleaseKiosk(int match) {
+        std::lock_guard<std::mutex> lock(mutex);
+        bracket.At(match).state = BracketState::READY;
+        version++;
+        UpdateKioskReady();
+    }
+
+    // Scores of the series finished since the last call (appended to out)
+    void TakeScores(std::vector<TournamentScore>& out) {
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock() || scores.empty()) return;
+        out.insert(out.end(), scores.begin(), scores.end());
+        scores.clear();
+    }
+
+    // Copies the bracket into view if it changed since view.version; false
+    // when unchanged or the workers hold the lock (keep drawing the old copy)
+    bool CopyIfChanged(TournamentView& view) {
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock() || view.version == version) return false;
+        view.version = version;
+        view.rounds = bracket.Rounds();
+        view.field = bracket.Field();
+        view.running = running;
+        view.champion = bracket.Champion();
+        view.players = players;
+        view.matches = bracket.Matches();
+        return true;
+    }
+
+private:
+    MatchSettings settings;
+    const WordDictionary* dictionary = nullptr;
+    uint64_t baseSeed = 0;
+    int threads = 0;
+
+    std::thread thread;
+    std::mutex mutex;               // guards everything below
+    std::condition_variable wake;   // a match finished, or Shutdown
+    bool stopping = false;
+    uint64_t version = 0;           // bumped on every bracket change
+    int running = 0;                // computer matches being played
+    std::vector<TournamentPlayer> players;
+    Bracket bracket;
+    std::vector<TournamentScore> scores;
+    std::atomic<bool> kioskReady{ false };
+
+    bool IsKiosk(const BracketMatch& m) const { return players[m.a].human || players[m.b].human; }
+
+    void UpdateKioskReady() {
+        bool any = false;
+        for (const BracketMatch& m : bracket.Matches()) {
+            if (m.state == BracketState::READY && IsKiosk(m)) any = true;
+        }
+        kioskReady.store(any, std::memory_order_relaxed);
+    }
+
+    // Under the lock
+    void Finish(int match, int scoreA, int scoreB) {
+        const BracketMatch& m = bracket.At(match);
+        scores.push_back(TournamentScore{ players[m.a].name, scoreA });
+        scores.push_back(TournamentScore{ players[m.b].name, scoreB });
+        bracket.Report(match, scoreA, scoreB);
+        version++;
+        UpdateKioskReady();
+    }
+
+    // Owns the workers: builds the shared lexicon, then waits for them
+    void Run() {
+        // Own lexicon: the game's is built lazily on the game thread. Read-only
+        // once built, so the workers share it.
+        PackedLexicon lexicon(*dictionary);
+        lexicon.BuildAll();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            UpdateKioskReady();
+        }
+
+        int count = threads > 0 ? threads : (int)std::thread::hardware_concurrency();
+        count = std::max(1, std::min(count, bracket.Field() / 2)); // never more than round one's matches
+        std::vector<std::thread> workers;
+        for (int w = 0; w < count; ++w) workers.emplace_back([this, &lexicon] { Work(lexicon); });
+        for (std::thread& t : workers) t.join();
+    }
+
+    // Next READY computer match, marked running; -1 if none. Under the lock.
+    int TakeComputerMatch() {
+        for (int m = 0; m < bracket.MatchCount(); ++m) {
+            BracketMatch& bm = bracket.At(m);
+            if (bm.state != BracketState::READY || IsKiosk(bm)) continue;
+            bm.state = BracketState::RUNNING;
+            running++;
+            version++;
+            return m;
+        }
+        return -1;
+    }
+
+    void Work(PackedLexicon& lexicon) {
+        HangmanSolver solver(lexicon);
+        TournamentRules match;
+        match.settings = settings;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            int m = -1;
+            wake.wait(lock, [&] {
+                if (stopping || bracket.Finished()) return true;
+                m = TakeComputerMatch();
+                return m >= 0;
+            });
+            if (m < 0) break;
+            lock.unlock();
+
+            std::mt19937_64 rng(baseSeed ^ ((uint64_t)(m + 1) * 0x9E3779B97F4A7C15ull));
+            PlayComputerSeries(match, *dictionary, solver, rng);
+
+            lock.lock();
+            running--;
+            Finish(m, match.player1Score, match.player2Score);
+            // The next round's match may be READY now; so may the final
+            wake.notify_all();
+        }
+    }
+};
@@ -0,0 +1,141 @@
+#pragma once
+// Screen geometry. Every screen is laid out once on a fixed virtual canvas
+// (1200x680) into a flat table of rectangles that both Update* (hit-testing)
+// and Draw* read, so the two can no longer disagree and nothing is
+// recomputed per frame.
+//
+// The canvas is fitted to the real window by UiView: a uniform scale plus
+// letterbox offset, applied to drawing as a Camera2D and to the mouse through
+// raylib's mouse offset/scale, so input events arrive in canvas coordinates.
+// It only changes when the window is resized.
+#include "raylib.h"
+#include <cstdint>
+
+static const int UI_CANVAS_W = 1200;
+static const int UI_CANVAS_H = 680;
+
+enum class UiRect : uint8_t {
+    CARD,             // white card on every screen but START
+    PLAY_SIDEBAR,     // PLAYING: rounds + scores column
+    PLAY_MAIN,        // PLAYING: title, word, keyboard, result
+    KEYBOARD,         // PLAYING: on-screen keyboard origin (size from the keyboard)
+    START_PLAY,       // START: stacked buttons
+    START_SOUND,
+    START_LEADERBOARD,
+    FOOTER_LEFT,      // BACK on settings / word entry
+    FOOTER_RIGHT,     // START ROUND / NEXT
+    FOOTER_CENTER,    // BACK on sound settings / leaderboard
+    SUMMARY_LOBBY,    // SUMMARY: wider buttons nearer the card edge
+    SUMMARY_QUIT,
+    WORD_BOX,         // ENTER_WORD text boxes
+    HINT_BOX,
+    COUNT
+};
+
+// Integer view of a rectangle, for code that positions text from it
+struct UiBox {
+    int x, y, w, h;
+};
+
+class UiLayout {
+public:
+    UiLayout() { Build(UI_CANVAS_W, UI_CANVAS_H); }
+
+    const Rectangle& operator[](UiRect r) const { return rects[(int)r]; }
+    UiBox Box(UiRect r) const { return boxes[(int)r]; }
+
+    // Card x, y, w, h, e.g. auto [cardX, cardY, cardW, cardH] = layout.Card();
+    UiBox Card() const { return boxes[(int)UiRect::CARD]; }
+
+    int Width() const { return width; }
+    int Height() const { return height; }
+
+    void Build(int w, int h) {
+        width = w;
+        height = h;
+
+        const int margin = 20;
+        UiBox card = { margin, margin, w - 2 * margin, h - 2 * margin };
+        Set(UiRect::CARD, card);
+
+        // PLAYING: sidebar, then the main area 30 px to its right
+        const int sidebarW = 220;
+        Set(UiRect::PLAY_SIDEBAR, { card.x, card.y, sidebarW, card.h });
+        UiBox main = { card.x + sidebarW + 30, card.y + 20, card.w - sidebarW - 50, card.h - 40 };
+        Set(UiRect::PLAY_MAIN, main);
+        // Under the word line (main.y + 60), 80 px down; the keyboard sizes itself
+        Set(UiRect::KEYBOARD, { main.x + 40, main.y + 60 + 80, 0, 0 });
+
+        // START: three buttons stacked below the middle
+        const int startW = 260, startH = 60, startGap = 20;
+        int startX = w / 2 - startW / 2;
+        int startY = h / 2 + 100;
+        Set(UiRect::START_PLAY,        { startX, startY, startW, startH });
+        Set(UiRect::START_SOUND,       { startX, startY + (startH + startGap), startW, startH });
+        Set(UiRect::START_LEADERBOARD, { startX, startY + 2 * (startH + startGap), startW, startH });
+
+        // Card footers
+        const int btnW = 200, btnH = 50;
+        int btnY = card.y + card.h - 130;
+        Set(UiRect::FOOTER_LEFT,   { card.x + 80, btnY, btnW, btnH });
+        Set(UiRect::FOOTER_RIGHT,  { card.x + card.w - 80 - btnW, btnY, btnW, btnH });
+        Set(UiRect::FOOTER_CENTER, { card.x + card.w / 2 - btnW / 2, btnY, btnW, btnH });
+
+        const int summaryW = 220;
+        Set(UiRect::SUMMARY_LOBBY, { card.x + 40, btnY, summaryW, btnH });
+        Set(UiRect::SUMMARY_QUIT,  { card.x + card.w - 40 - summaryW, btnY, summaryW, btnH });
+
+        // ENTER_WORD: boxes around the values at card.x + 280
+        int xValue = card.x + 280;
+        Set(UiRect::WORD_BOX, { xValue - 10, card.y + 115, 360, 40 });
+        Set(UiRect::HINT_BOX, { xValue - 10, card.y + 185, 480, 40 });
+    }
+
+private:
+    Rectangle rects[(int)UiRect::COUNT] = {};
+    UiBox boxes[(int)UiRect::COUNT] = {};
+    int width = 0;
+    int height = 0;
+
+    void Set(UiRect r, UiBox b) {
+        boxes[(int)r] = b;
+        rects[(int)r] = Rectangle{ (float)b.x, (float)b.y, (float)b.w, (float)b.h };
+    }
+};
+
+// Fits the canvas into the window: largest uniform scale, centred
+class UiView {
+public:
+    // Recomputes the fit; true if it changed (call on start and on resize)
+    bool Fit(int windowW, int windowH) {
+        if (windowW == fitW && windowH == fitH) return false;
+        fitW = windowW;
+        fitH = windowH;
+
+        float sx = (float)windowW / UI_CANVAS_W;
+        float sy = (float)windowH / UI_CANVAS_H;
+        scale = sx < sy ? sx : sy;
+        if (scale <= 0.0f) scale = 1.0f; // minimized
+        offset.x = (windowW - UI_CANVAS_W * scale) * 0.5f;
+        offset.y = (windowH - UI_CANVAS_H * scale) * 0.5f;
+
+        // GetMousePosition() = (raw + offset) * scale: window -> canvas
+        SetMouseOffset((int)-offset.x, (int)-offset.y);
+        SetMouseScale(1.0f / scale, 1.0f / scale);
+        return true;
+    }
+
+    Camera2D Camera() const {
+        Camera2D cam{};
+        cam.offset = offset;
+        cam.zoom = scale;
+        return cam;
+    }
+
+    float Scale() const { return scale; }
+
+private:
+    int fitW = 0, fitH = 0;
+    float scale = 1.0f;
+    Vector2 offset{};
+};
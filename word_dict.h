@@ -0,0 +1,209 @@
+#pragma once
+// words.dict: a large word list, pre-indexed at build time by dict_builder
+// and memory-mapped by the game. Nothing is parsed or allocated on load.
+//
+// Words are bucketed by (length, distinct-letter count). Each bucket is one
+// contiguous run of fixed-stride records, sorted by which of the rare
+// letters JQXZKV the word uses (its letter-set group), with the start of
+// each group stored. Picking a random word that meets length / difficulty
+// constraints and avoids rare letters is a handful of array lookups.
+//
+// Layout: DictHeader, DictBucket[DICT_MAX_LEN + 1][DICT_MAX_LEN + 1],
+// uint32_t groupStart[same buckets][DICT_GROUPS], then the bucket payloads
+// (each 4-byte aligned).
+#include "mapped_file.h"
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+static const char     DICT_MAGIC[4] = { 'H', 'G', 'W', 'D' };
+static const uint32_t DICT_VERSION  = 2; // 2: letter-set groups inside each bucket
+static const int      DICT_MAX_LEN  = 20; // same limit as the word entry box
+
+// Letters indexed inside each bucket: bit i of a group is DICT_GROUP_LETTERS[i]
+static const char     DICT_GROUP_LETTERS[] = "JQXZKV";
+static const int      DICT_GROUP_BITS = 6;
+static const int      DICT_GROUPS = 1 << DICT_GROUP_BITS;
+
+struct DictHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t wordCount;
+    uint32_t reserved;
+};
+
+// Words of one length with one distinct-letter count
+struct DictBucket {
+    uint32_t offset; // from start of the file
+    uint32_t count;
+};
+
+// Record: uint32_t letter mask (bit i = 'A' + i), then the upper-case
+// letters, zero-padded to the stride
+inline uint32_t DictStride(int len) { return 4u + ((uint32_t)len + 3u) / 4u * 4u; }
+
+inline uint32_t LetterMask(const char* w, int len) {
+    uint32_t mask = 0;
+    for (int i = 0; i < len; ++i) {
+        if (w[i] >= 'A' && w[i] <= 'Z') mask |= 1u << (w[i] - 'A');
+    }
+    return mask;
+}
+
+// Letter-set group of a letter mask: which of DICT_GROUP_LETTERS it uses
+inline uint32_t LetterGroup(uint32_t mask) {
+    uint32_t g = 0;
+    for (int i = 0; i < DICT_GROUP_BITS; ++i) {
+        if (mask & (1u << (DICT_GROUP_LETTERS[i] - 'A'))) g |= 1u << i;
+    }
+    return g;
+}
+
+// Constraints for a random pick (inclusive ranges)
+struct DictQuery {
+    int minLen = 3;
+    int maxLen = DICT_MAX_LEN;
+    int minDistinct = 1;
+    int maxDistinct = DICT_MAX_LEN;
+    uint32_t excludeMask = 0; // words using any of these letters are skipped
+};
+
+class WordDictionary {
+public:
+    bool Open(const char* path) {
+        if (!file.Open(path)) return false;
+
+        const size_t tableEnd = sizeof(DictHeader) + (sizeof(DictBucket) + 4 * DICT_GROUPS) * BUCKETS;
+        bool ok = file.Size() >= tableEnd &&
+                  std::memcmp(Header()->magic, DICT_MAGIC, 4) == 0 &&
+                  Header()->version == DICT_VERSION;
+        for (int len = 0; ok && len <= DICT_MAX_LEN; ++len) {
+            for (int d = 0; d <= DICT_MAX_LEN; ++d) {
+                const DictBucket& b = Bucket(len, d);
+                if ((uint64_t)b.offset + (uint64_t)b.count * DictStride(len) > file.Size()) ok = false;
+                for (int g = 0; ok && g < DICT_GROUPS; ++g) {
+                    if (GroupBegin(len, d, g) > GroupEnd(len, d, g) || GroupEnd(len, d, g) > b.count) ok = false;
+                }
+            }
+        }
+        if (!ok) file.Close();
+        return ok;
+    }
+
+    bool IsOpen() const { return file.IsOpen(); }
+    uint32_t WordCount() const { return file.IsOpen() ? Header()->wordCount : 0; }
+
+    const DictBucket& Bucket(int len, int distinct) const {
+        return Table()[len * (DICT_MAX_LEN + 1) + distinct];
+    }
+
+    // Record i of a bucket: letters (not NUL-terminated, len chars) and mask
+    const char* Word(int len, const DictBucket& b, uint32_t i) const {
+        return (const char*)(file.Data() + b.offset + i * DictStride(len) + 4);
+    }
+    uint32_t Mask(int len, const DictBucket& b, uint32_t i) const {
+        uint32_t m;
+        std::memcpy(&m, file.Data() + b.offset + i * DictStride(len), 4);
+        return m;
+    }
+
+    // Records [GroupBegin, GroupEnd) of a bucket are letter-set group g
+    uint32_t GroupBegin(int len, int distinct, int g) const {
+        return GroupTable()[(len * (DICT_MAX_LEN + 1) + distinct) * DICT_GROUPS + g];
+    }
+    uint32_t GroupEnd(int len, int distinct, int g) const {
+        return g + 1 < DICT_GROUPS ? GroupBegin(len, distinct, g + 1) : Bucket(len, distinct).count;
+    }
+
+    // Uniform pick over every word matching q. Groups using an excluded
+    // JQXZKV letter are skipped outright, so with only those excluded (EASY)
+    // the cost is one draw plus a walk over the bucket/group table, whatever
+    // the word count. Other excluded letters are handled by rejection
+    // sampling; if every attempt is rejected, one pass over the allowed
+    // groups picks uniformly among the words that pass (O(words in range),
+    // only for exclusions that leave almost nothing), so false means none
+    // does. Writes len chars + NUL into out.
+    template <class Rng>
+    bool Pick(const DictQuery& q, Rng& rng, char (&out)[DICT_MAX_LEN + 1]) const {
+        if (!file.IsOpen()) return false;
+        int minLen = q.minLen < 1 ? 1 : q.minLen;
+        int maxLen = q.maxLen > DICT_MAX_LEN ? DICT_MAX_LEN : q.maxLen;
+        int minD = q.minDistinct < 1 ? 1 : q.minDistinct;
+        int maxD = q.maxDistinct > DICT_MAX_LEN ? DICT_MAX_LEN : q.maxDistinct;
+
+        uint32_t excludedGroups = LetterGroup(q.excludeMask);
+        uint32_t rest = q.excludeMask & ~LetterMask(DICT_GROUP_LETTERS, DICT_GROUP_BITS);
+        int groups[DICT_GROUPS];
+        int groupCount = 0;
+        for (int g = 0; g < DICT_GROUPS; ++g) {
+            if (((uint32_t)g & excludedGroups) == 0) groups[groupCount++] = g;
+        }
+
+        uint64_t total = 0;
+        for (int len = minLen; len <= maxLen; ++len)
+            for (int d = minD; d <= maxD && d <= len; ++d)
+                for (int k = 0; k < groupCount; ++k)
+                    total += GroupEnd(len, d, groups[k]) - GroupBegin(len, d, groups[k]);
+        if (total == 0) return false;
+
+        for (int attempt = 0; attempt < PICK_ATTEMPTS; ++attempt) {
+            uint64_t r = std::uniform_int_distribution<uint64_t>(0, total - 1)(rng);
+
+            // Walk the allowed group sizes down to the r-th word in range
+            int len = minLen, d = minD, k = 0;
+            for (;; ) {
+                uint32_t size = GroupEnd(len, d, groups[k]) - GroupBegin(len, d, groups[k]);
+                if (r < size) break;
+                r -= size;
+                if (++k < groupCount) continue;
+                k = 0;
+                if (++d > maxD || d > len) { d = minD; ++len; }
+            }
+
+            const DictBucket& b = Bucket(len, d);
+            uint32_t i = GroupBegin(len, d, groups[k]) + (uint32_t)r;
+            if (Mask(len, b, i) & rest) continue;
+            std::memcpy(out, Word(len, b, i), len);
+            out[len] = '\0';
+            return true;
+        }
+
+        // Mostly excluded: reservoir sample over the words that pass
+        uint64_t seen = 0;
+        int pickLen = 0;
+        const char* pick = nullptr;
+        for (int len = minLen; len <= maxLen; ++len) {
+            for (int d = minD; d <= maxD && d <= len; ++d) {
+                const DictBucket& b = Bucket(len, d);
+                for (int k = 0; k < groupCount; ++k) {
+                    uint32_t end = GroupEnd(len, d, groups[k]);
+                    for (uint32_t i = GroupBegin(len, d, groups[k]); i < end; ++i) {
+                        if (Mask(len, b, i) & rest) continue;
+                        if (std::uniform_int_distribution<uint64_t>(0, seen++)(rng) == 0) {
+                            pick = Word(len, b, i);
+                            pickLen = len;
+                        }
+                    }
+                }
+            }
+        }
+        if (pick == nullptr) return false;
+        std::memcpy(out, pick, pickLen);
+        out[pickLen] = '\0';
+        return true;
+    }
+
+private:
+    static const int BUCKETS = (DICT_MAX_LEN + 1) * (DICT_MAX_LEN + 1);
+    static const int PICK_ATTEMPTS = 32; // rejection draws before the full scan
+
+    MappedFile file;
+
+    const DictHeader* Header() const { return (const DictHeader*)file.Data(); }
+    const DictBucket* Table() const {
+        return (const DictBucket*)(file.Data() + sizeof(DictHeader));
+    }
+    const uint32_t* GroupTable() const {
+        return (const uint32_t*)(file.Data() + sizeof(DictHeader) + sizeof(DictBucket) * BUCKETS);
+    }
+};
@@ -0,0 +1,86 @@
+#pragma once
+// Work-stealing parallel-for for the headless tools. The index range is cut
+// into chunks dealt round-robin to per-worker deques; a worker runs its own
+// chunks from the back and, when it runs dry, steals from the front of the
+// others. Uneven chunks (long words, hard rounds) even out without a shared
+// queue every worker contends on.
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    explicit WorkStealingPool(int threads = 0) {
+        workerCount = threads > 0 ? threads : (int)std::thread::hardware_concurrency();
+        if (workerCount < 1) workerCount = 1;
+    }
+
+    int Workers() const { return workerCount; }
+
+    // Chunks taken from another worker's deque in the last ParallelFor
+    size_t Steals() const { return steals; }
+
+    // Calls fn(worker, begin, end) over [0, n) in chunks of at most grain;
+    // returns when every chunk is done. worker is in [0, Workers()).
+    template <class Fn>
+    void ParallelFor(size_t n, size_t grain, Fn fn) {
+        if (grain == 0) grain = 1;
+        std::vector<Queue> queues(workerCount);
+        size_t chunk = 0;
+        for (size_t b = 0; b < n; b += grain, ++chunk) {
+            queues[chunk % workerCount].ranges.push_back({ b, std::min(n, b + grain) });
+        }
+
+        std::atomic<size_t> stolen{ 0 };
+        auto run = [&](int self) {
+            Range r;
+            while (PopOwn(queues[self], r) || Steal(queues, self, r, stolen)) {
+                fn(self, r.begin, r.end);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (int w = 1; w < workerCount; ++w) threads.emplace_back(run, w);
+        run(0);
+        for (std::thread& t : threads) t.join();
+        steals = stolen.load();
+    }
+
+private:
+    struct Range {
+        size_t begin, end;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Range> ranges;
+    };
+
+    int workerCount = 1;
+    size_t steals = 0;
+
+    static bool PopOwn(Queue& q, Range& out) {
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.ranges.empty()) return false;
+        out = q.ranges.back();
+        q.ranges.pop_back();
+        return true;
+    }
+
+    bool Steal(std::vector<Queue>& queues, int self, Range& out, std::atomic<size_t>& stolen) {
+        for (int k = 1; k < workerCount; ++k) {
+            Queue& victim = queues[(self + k) % workerCount];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.ranges.empty()) continue;
+            out = victim.ranges.front();
+            victim.ranges.pop_front();
+            stolen++;
+            return true;
+        }
+        return false;
+    }
+};